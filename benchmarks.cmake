@@ -0,0 +1,47 @@
+# Performance benchmarks, built on Google Benchmark (https://github.com/google/benchmark)
+find_package(benchmark REQUIRED)
+
+# release tracking suite: every public operation and kernel from 8 B to 64 MiB, bytes/s and allocs/op
+add_executable(byteao_benchmarks benchmarks/suite_bench.cpp benchmarks/alloc_counter.cpp)
+target_link_libraries(byteao_benchmarks PRIVATE jlizard::byte-ao benchmark::benchmark_main)
+target_include_directories(byteao_benchmarks PRIVATE "${CMAKE_CURRENT_SOURCE_DIR}/include/private")
+
+# runs the suite and writes a JSON report to compare across releases
+add_custom_target(byteao_benchmarks_json
+        COMMAND byteao_benchmarks
+                --benchmark_out=${CMAKE_BINARY_DIR}/byteao_benchmarks.json
+                --benchmark_out_format=json
+        DEPENDS byteao_benchmarks
+        WORKING_DIRECTORY ${CMAKE_BINARY_DIR}
+        COMMENT "Writing ${CMAKE_BINARY_DIR}/byteao_benchmarks.json"
+        USES_TERMINAL)
+
+add_executable(byteao_xor_bench benchmarks/xor_bench.cpp)
+target_link_libraries(byteao_xor_bench PRIVATE jlizard::byte-ao benchmark::benchmark_main)
+# the kernels under test live behind the private headers
+target_include_directories(byteao_xor_bench PRIVATE "${CMAKE_CURRENT_SOURCE_DIR}/include/private")
+
+add_executable(byteao_random_bench benchmarks/random_bench.cpp)
+target_link_libraries(byteao_random_bench PRIVATE jlizard::byte-ao benchmark::benchmark_main)
+
+add_executable(byteao_compare_bench benchmarks/compare_bench.cpp)
+target_link_libraries(byteao_compare_bench PRIVATE jlizard::byte-ao benchmark::benchmark_main)
+
+add_executable(byteao_wipe_bench benchmarks/wipe_bench.cpp)
+target_link_libraries(byteao_wipe_bench PRIVATE jlizard::byte-ao benchmark::benchmark_main)
+target_include_directories(byteao_wipe_bench PRIVATE "${CMAKE_CURRENT_SOURCE_DIR}/include/private")
+
+add_executable(byteao_concat_bench benchmarks/concat_bench.cpp)
+target_link_libraries(byteao_concat_bench PRIVATE jlizard::byte-ao benchmark::benchmark_main)
+
+add_executable(byteao_map_bench benchmarks/map_bench.cpp)
+target_link_libraries(byteao_map_bench PRIVATE jlizard::byte-ao benchmark::benchmark_main)
+
+add_executable(byteao_parallel_bench benchmarks/parallel_bench.cpp)
+target_link_libraries(byteao_parallel_bench PRIVATE jlizard::byte-ao benchmark::benchmark_main)
+
+add_executable(byteao_batch_bench benchmarks/batch_bench.cpp)
+target_link_libraries(byteao_batch_bench PRIVATE jlizard::byte-ao benchmark::benchmark_main)
+
+add_executable(byteao_bitwise_bench benchmarks/bitwise_bench.cpp)
+target_link_libraries(byteao_bitwise_bench PRIVATE jlizard::byte-ao benchmark::benchmark_main)
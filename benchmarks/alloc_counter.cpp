@@ -0,0 +1,93 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file alloc_counter.cpp
+ * @brief Replacement global allocation functions counting the allocations of the benchmark suite
+ *
+ * Kept out of suite_bench.cpp: once inlined into the benchmark bodies, GCC pairs them with
+ * the standard library's allocations and reports -Wmismatched-new-delete.
+ */
+
+#include "alloc_counter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace
+{
+    std::atomic<size_t> g_allocations{0};
+}
+
+size_t bench::allocation_count() noexcept
+{
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+// counts every allocation of the process, including the aligned forms the default memory
+// resource (and therefore ByteStorage) allocates through
+void* operator new(const size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+void* operator new(const size_t size, const std::align_val_t alignment)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<size_t>(alignment);
+#if defined(_WIN32)
+    if (void* p = _aligned_malloc(size == 0 ? 1 : size, align)) return p;
+#else
+    // aligned_alloc wants a multiple of the alignment
+    if (void* p = std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align)) return p;
+#endif
+    throw std::bad_alloc();
+}
+
+#if defined(_WIN32)
+void operator delete(void* p, std::align_val_t) noexcept { _aligned_free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { _aligned_free(p); }
+#else
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+#endif
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_array.h"
+#include "jlizard/byte_array_batch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace jlizard;
+
+namespace
+{
+    constexpr size_t kRecords = 10000;
+
+    std::vector<ByteArray> make_records(const size_t record_size)
+    {
+        std::vector<ByteArray> records;
+        records.reserve(kRecords);
+        for (size_t i = 0; i < kRecords; ++i) {
+            records.emplace_back(record_size, static_cast<unsigned char>(i));
+        }
+        return records;
+    }
+
+    // one operator^ and one fresh ByteArray per record, the pattern the batch API replaces
+    void BM_MaskPerRecord(benchmark::State& state)
+    {
+        const auto record_size = static_cast<size_t>(state.range(0));
+        const auto records = make_records(record_size);
+        const ByteArray key(record_size, 0xA5);
+        for (auto _ : state) {
+            std::vector<ByteArray> masked;
+            masked.reserve(kRecords);
+            for (const auto& record : records) {
+                masked.emplace_back(record ^ key);
+            }
+            benchmark::DoNotOptimize(masked.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * kRecords * record_size));
+    }
+
+    // the same masks through ByteArray::xor_batch into reused outputs
+    void BM_MaskXorBatch(benchmark::State& state)
+    {
+        const auto record_size = static_cast<size_t>(state.range(0));
+        const auto records = make_records(record_size);
+        const std::vector<ByteView> views(records.begin(), records.end());
+        const ByteArray key(record_size, 0xA5);
+        std::vector<ByteArray> masked(kRecords);
+        for (auto _ : state) {
+            ByteArray::xor_batch(views, key, masked);
+            benchmark::DoNotOptimize(masked.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * kRecords * record_size));
+    }
+
+    // the records stored contiguously in a ByteArrayBatch, one pass over the block
+    void BM_MaskByteArrayBatch(benchmark::State& state)
+    {
+        const auto record_size = static_cast<size_t>(state.range(0));
+        ByteArrayBatch records(record_size);
+        for (const auto& record : make_records(record_size)) records.push_back(record);
+        const ByteArray key(record_size, 0xA5);
+        ByteArrayBatch masked;
+        for (auto _ : state) {
+            ByteArrayBatch::xor_into(records, key, masked);
+            benchmark::DoNotOptimize(masked.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * kRecords * record_size));
+    }
+}
+
+BENCHMARK(BM_MaskPerRecord)->Arg(16)->Arg(64)->Arg(256);
+BENCHMARK(BM_MaskXorBatch)->Arg(16)->Arg(64)->Arg(256);
+BENCHMARK(BM_MaskByteArrayBatch)->Arg(16)->Arg(64)->Arg(256);
@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_array.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+using namespace jlizard;
+
+namespace
+{
+    ByteArray make_array(const size_t size, const unsigned char seed)
+    {
+        ByteArray array(size, 0x00);
+        for (size_t i = 0; i < size; ++i) {
+            array.unchecked(i) = static_cast<unsigned char>(i * 31 + seed);
+        }
+        return array;
+    }
+
+    void set_bytes(benchmark::State& state)
+    {
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    // the byte at a time loops callers had to write by hand before
+    void BM_AndByteLoop(benchmark::State& state)
+    {
+        const ByteArray filter = make_array(static_cast<size_t>(state.range(0)), 7);
+        ByteArray bitmap = make_array(static_cast<size_t>(state.range(0)), 1);
+        for (auto _ : state) {
+            for (size_t i = 0; i < bitmap.size(); ++i) bitmap.at(i) &= filter[i];
+            benchmark::DoNotOptimize(bitmap.data());
+            benchmark::ClobberMemory();
+        }
+        set_bytes(state);
+    }
+
+    void BM_AndAssign(benchmark::State& state)
+    {
+        const ByteArray filter = make_array(static_cast<size_t>(state.range(0)), 7);
+        ByteArray bitmap = make_array(static_cast<size_t>(state.range(0)), 1);
+        for (auto _ : state) {
+            bitmap &= filter;
+            benchmark::DoNotOptimize(bitmap.data());
+            benchmark::ClobberMemory();
+        }
+        set_bytes(state);
+    }
+
+    void BM_ShiftByteLoop(benchmark::State& state)
+    {
+        ByteArray array = make_array(static_cast<size_t>(state.range(0)), 1);
+        for (auto _ : state) {
+            const size_t last = array.size() - 1;
+            for (size_t i = 0; i < last; ++i) {
+                array.at(i) = static_cast<unsigned char>(array[i] << 3 | array[i + 1] >> 5);
+            }
+            array.at(last) = static_cast<unsigned char>(array[last] << 3);
+            benchmark::DoNotOptimize(array.data());
+            benchmark::ClobberMemory();
+        }
+        set_bytes(state);
+    }
+
+    void BM_ShiftAssign(benchmark::State& state)
+    {
+        ByteArray array = make_array(static_cast<size_t>(state.range(0)), 1);
+        for (auto _ : state) {
+            array <<= 3;
+            benchmark::DoNotOptimize(array.data());
+            benchmark::ClobberMemory();
+        }
+        set_bytes(state);
+    }
+
+    void BM_HammingByteLoop(benchmark::State& state)
+    {
+        const ByteArray a = make_array(static_cast<size_t>(state.range(0)), 1);
+        const ByteArray b = make_array(static_cast<size_t>(state.range(0)), 7);
+        for (auto _ : state) {
+            uint64_t distance = 0;
+            for (size_t i = 0; i < a.size(); ++i) {
+                unsigned char diff = a[i] ^ b[i];
+                for (; diff != 0; diff &= diff - 1) ++distance;
+            }
+            benchmark::DoNotOptimize(distance);
+        }
+        set_bytes(state);
+    }
+
+    void BM_HammingDistance(benchmark::State& state)
+    {
+        const ByteArray a = make_array(static_cast<size_t>(state.range(0)), 1);
+        const ByteArray b = make_array(static_cast<size_t>(state.range(0)), 7);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(hamming_distance(a, b));
+        }
+        set_bytes(state);
+    }
+
+    void BM_Popcount(benchmark::State& state)
+    {
+        const ByteArray a = make_array(static_cast<size_t>(state.range(0)), 1);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(popcount(a));
+        }
+        set_bytes(state);
+    }
+}
+
+BENCHMARK(BM_AndByteLoop)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_AndAssign)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_ShiftByteLoop)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_ShiftAssign)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_HammingByteLoop)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_HammingDistance)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_Popcount)->RangeMultiplier(8)->Range(64, 4 << 20);
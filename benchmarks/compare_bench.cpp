@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_array.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace jlizard;
+
+namespace
+{
+    ByteArray make_array(const size_t size)
+    {
+        ByteArray array(size, 0x00);
+        for (size_t i = 0; i < size; ++i) {
+            array.unchecked(i) = static_cast<unsigned char>(i * 31 + 1);
+        }
+        return array;
+    }
+
+    // Runs the comparison on two equal arrays, the worst case for an early exit
+    template <typename Compare>
+    void run_compare_bench(benchmark::State& state, Compare&& compare)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        const ByteArray a = make_array(size);
+        const ByteArray b = make_array(size);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(compare(ByteView(a), ByteView(b)));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    }
+
+    // The previous operator== algorithm
+    void BM_EqualsRanges(benchmark::State& state)
+    {
+        run_compare_bench(state, [](const ByteView a, const ByteView b) { return std::ranges::equal(a, b); });
+    }
+
+    void BM_EqualsMemcmp(benchmark::State& state)
+    {
+        run_compare_bench(state, [](const ByteView a, const ByteView b) { return a == b; });
+    }
+
+    void BM_SecureEquals(benchmark::State& state)
+    {
+        run_compare_bench(state, [](const ByteView a, const ByteView b) { return secure_equals(a, b); });
+    }
+}
+
+BENCHMARK(BM_EqualsRanges)->RangeMultiplier(8)->Range(16, 1 << 20);
+BENCHMARK(BM_EqualsMemcmp)->RangeMultiplier(8)->Range(16, 1 << 20);
+BENCHMARK(BM_SecureEquals)->RangeMultiplier(8)->Range(16, 1 << 20);
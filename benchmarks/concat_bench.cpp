@@ -0,0 +1,70 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_array.h"
+#include "jlizard/byte_chain.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace jlizard;
+
+namespace
+{
+    // header + payload + MAC, the typical protocol frame
+    struct Frame
+    {
+        ByteArray header = ByteArray(16, 0x01);
+        ByteArray payload;
+        ByteArray mac = ByteArray(32, 0x03);
+
+        explicit Frame(const size_t payload_size) : payload(payload_size, 0x02) {}
+    };
+
+    void BM_FrameConcat(benchmark::State& state)
+    {
+        const Frame frame(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            ByteArray wire;
+            wire.concat(frame.header).concat(frame.payload).concat(frame.mac);
+            benchmark::DoNotOptimize(wire.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * (state.range(0) + 48));
+    }
+
+    void BM_FrameChainFlatten(benchmark::State& state)
+    {
+        const Frame frame(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            ByteChain chain;
+            chain.append(frame.header).append(frame.payload).append(frame.mac);
+            ByteArray wire = chain.flatten();
+            benchmark::DoNotOptimize(wire.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * (state.range(0) + 48));
+    }
+}
+
+BENCHMARK(BM_FrameConcat)->RangeMultiplier(8)->Range(64, 1 << 20);
+BENCHMARK(BM_FrameChainFlatten)->RangeMultiplier(8)->Range(64, 1 << 20);
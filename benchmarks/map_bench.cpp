@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_array.h"
+#include "jlizard/mapped_byte_array.h"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace jlizard;
+
+namespace
+{
+    // a key store blob in the temporary directory, rewritten for every size
+    std::filesystem::path write_blob(const size_t size)
+    {
+        const auto path = std::filesystem::temp_directory_path() / ("byteao_map_bench_" + std::to_string(size) + ".bin");
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        const std::vector<char> bytes(size, 0x5A);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        return path;
+    }
+
+    // the loader as it used to be: read the whole file and copy it into a ByteArray
+    void BM_LoadCopy(benchmark::State& state)
+    {
+        const auto path = write_blob(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            std::ifstream file(path, std::ios::binary);
+            const std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            const ByteArray blob(bytes);
+            const ByteArray key(ByteView(blob).subview(blob.size() / 2, 32));
+            benchmark::DoNotOptimize(key.data());
+        }
+        std::filesystem::remove(path);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    // mapping the same file and reading one key out of it, only the touched page is read
+    void BM_LoadMapped(benchmark::State& state)
+    {
+        const auto path = write_blob(static_cast<size_t>(state.range(0)));
+        for (auto _ : state) {
+            const MappedByteArray blob(path);
+            const ByteArray key(blob.view().subview(blob.size() / 2, 32));
+            benchmark::DoNotOptimize(key.data());
+        }
+        std::filesystem::remove(path);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+}
+
+BENCHMARK(BM_LoadCopy)->RangeMultiplier(16)->Range(4 << 10, 64 << 20);
+BENCHMARK(BM_LoadMapped)->RangeMultiplier(16)->Range(4 << 10, 64 << 20);
@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_array.h"
+#include "jlizard/parallel.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace jlizard;
+
+namespace
+{
+    // range(0) is the buffer size, range(1) the thread count (1 = single threaded, 0 = one per core)
+    class ParallelFixture : public benchmark::Fixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            saved_ = parallel::config();
+            parallel::set_config({.max_threads = static_cast<unsigned>(state.range(1))});
+            const auto size = static_cast<size_t>(state.range(0));
+            a_ = ByteArray(size, 0x5A);
+            b_ = ByteArray(size, 0xA5);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            parallel::set_config(saved_);
+        }
+
+    protected:
+        parallel::Config saved_;
+        ByteArray a_;
+        ByteArray b_;
+        ByteArray out_;
+    };
+
+    BENCHMARK_DEFINE_F(ParallelFixture, Xor)(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            ByteArray::xor_into(a_, b_, out_);
+            benchmark::DoNotOptimize(out_.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+        state.counters["threads"] = parallel::thread_count();
+    }
+
+    BENCHMARK_DEFINE_F(ParallelFixture, Complement)(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            ByteArray::complement_into(a_, out_);
+            benchmark::DoNotOptimize(out_.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+        state.counters["threads"] = parallel::thread_count();
+    }
+
+    BENCHMARK_DEFINE_F(ParallelFixture, SecureEquals)(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(secure_equals(a_, b_));
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+        state.counters["threads"] = parallel::thread_count();
+    }
+
+    void parallel_args(benchmark::internal::Benchmark* bench)
+    {
+        for (const int64_t size : {16 << 20, 64 << 20, 256 << 20}) {
+            for (const int64_t threads : {1, 2, 4, 0}) {
+                bench->Args({size, threads});
+            }
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(ParallelFixture, Xor)->Apply(parallel_args)->UseRealTime();
+BENCHMARK_REGISTER_F(ParallelFixture, Complement)->Apply(parallel_args)->UseRealTime();
+BENCHMARK_REGISTER_F(ParallelFixture, SecureEquals)->Apply(parallel_args)->UseRealTime();
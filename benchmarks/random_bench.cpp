@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_array.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+using namespace jlizard;
+
+namespace
+{
+    // The previous create_from_prng algorithm: one random_device draw per byte
+    void BM_PrngPerByteRandomDevice(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        ByteArray out(size, 0x00);
+        std::random_device rd;
+        std::uniform_int_distribution<unsigned int> dist(0, 255);
+        for (auto _ : state) {
+            for (size_t i = 0; i < size; ++i) {
+                out.unchecked(i) = static_cast<unsigned char>(dist(rd));
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    }
+
+    void run_fill_bench(benchmark::State& state, const ERandomSource source)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        ByteArray out(size, 0x00);
+        for (auto _ : state) {
+            ByteArray::fill_random(out, source);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    }
+
+    void BM_FillRandomSystem(benchmark::State& state)
+    {
+        run_fill_bench(state, ERandomSource::SYSTEM);
+    }
+
+    void BM_FillRandomThreadDrbg(benchmark::State& state)
+    {
+        run_fill_bench(state, ERandomSource::THREAD_DRBG);
+    }
+}
+
+BENCHMARK(BM_PrngPerByteRandomDevice)->RangeMultiplier(16)->Range(16, 64 << 10);
+BENCHMARK(BM_FillRandomSystem)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK(BM_FillRandomThreadDrbg)->RangeMultiplier(16)->Range(16, 1 << 20);
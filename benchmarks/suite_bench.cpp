@@ -0,0 +1,513 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+/**
+ * @file suite_bench.cpp
+ * @brief Release tracking suite: every public ByteArray operation and the ByteArrayOps and
+ * SecureErase kernels from 8 B to 64 MiB
+ *
+ * Every benchmark reports bytes/second and `allocs/op`, the number of global operator new
+ * calls per iteration. Run with `--benchmark_out=<file> --benchmark_out_format=json` (or
+ * build the `byteao_benchmarks_json` target) to get a machine readable report that can be
+ * compared across releases, e.g. with Google Benchmark's tools/compare.py.
+ */
+
+#include "jlizard/byte_array.h"
+#include "jlizard/byte_array_ops.h"
+#include "jlizard/byte_reader.h"
+#include "jlizard/byte_writer.h"
+#include "jlizard/security_ops.h"
+#include "jlizard/shared_byte_array.h"
+
+#include "alloc_counter.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace jlizard;
+
+namespace
+{
+    ByteArray make_array(const size_t size, const unsigned char seed)
+    {
+        ByteArray array(size, 0x00);
+        for (size_t i = 0; i < size; ++i) {
+            array.at(i) = static_cast<unsigned char>(i * 31 + seed);
+        }
+        return array;
+    }
+
+    // runs body once per iteration and reports bytes/second over range(0) bytes and allocs/op
+    template <typename Body>
+    void measure(benchmark::State& state, Body&& body)
+    {
+        const size_t before = bench::allocation_count();
+        for (auto _ : state) {
+            body();
+            benchmark::ClobberMemory();
+        }
+        const size_t allocations = bench::allocation_count() - before;
+        state.counters["allocs/op"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+
+    size_t arg_size(const benchmark::State& state)
+    {
+        return static_cast<size_t>(state.range(0));
+    }
+
+    // ---- construction and conversion
+
+    void BM_ConstructFilled(benchmark::State& state)
+    {
+        const size_t size = arg_size(state);
+        measure(state, [&] {
+            ByteArray array(size, 0x5A);
+            benchmark::DoNotOptimize(array.data());
+        });
+    }
+
+    void BM_CopyConstruct(benchmark::State& state)
+    {
+        const ByteArray source = make_array(arg_size(state), 1);
+        measure(state, [&] {
+            ByteArray copy(source);
+            benchmark::DoNotOptimize(copy.data());
+        });
+    }
+
+    // one payload handed to 8 consumers, deep copies against shared handles
+    void BM_FanOutCopy(benchmark::State& state)
+    {
+        const ByteArray payload = make_array(arg_size(state), 1);
+        std::vector<ByteArray> consumers(8);
+        measure(state, [&] {
+            for (auto& consumer : consumers) consumer = payload;
+            benchmark::DoNotOptimize(consumers.back().data());
+        });
+    }
+
+    void BM_FanOutShared(benchmark::State& state)
+    {
+        const SharedByteArray payload(make_array(arg_size(state), 1));
+        std::vector<SharedByteArray> consumers(8);
+        measure(state, [&] {
+            for (auto& consumer : consumers) consumer = payload;
+            benchmark::DoNotOptimize(consumers.back().data());
+        });
+    }
+
+    void BM_MoveConstruct(benchmark::State& state)
+    {
+        ByteArray source = make_array(arg_size(state), 1);
+        measure(state, [&] {
+            ByteArray moved(std::move(source));
+            source = std::move(moved);
+            benchmark::DoNotOptimize(source.data());
+        });
+    }
+
+    void BM_ConstructFromHex(benchmark::State& state)
+    {
+        const std::string hex = make_array(arg_size(state), 1).as_hex_string();
+        measure(state, [&] {
+            ByteArray array(hex);
+            benchmark::DoNotOptimize(array.data());
+        });
+    }
+
+    void BM_AsHexString(benchmark::State& state)
+    {
+        const ByteArray source = make_array(arg_size(state), 1);
+        measure(state, [&] {
+            std::string hex = source.as_hex_string();
+            benchmark::DoNotOptimize(hex.data());
+        });
+    }
+
+    void BM_ToHexChars(benchmark::State& state)
+    {
+        const ByteArray source = make_array(arg_size(state), 1);
+        std::vector<char> buffer(source.size() * 2);
+        measure(state, [&] {
+            benchmark::DoNotOptimize(source.to_hex_chars(buffer.data(), buffer.data() + buffer.size()));
+        });
+    }
+
+    void BM_ConcatCopy(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state) / 2, 1);
+        const ByteArray b = make_array(arg_size(state) - a.size(), 2);
+        measure(state, [&] {
+            ByteArray joined = a.concat_copy(b);
+            benchmark::DoNotOptimize(joined.data());
+        });
+    }
+
+    // a frame of 2 byte length prefixed 14 byte records, built in a std::vector and copied in
+    void BM_FrameViaVector(benchmark::State& state)
+    {
+        const size_t size = arg_size(state);
+        const ByteArray record = make_array(14, 1);
+        measure(state, [&] {
+            std::vector<unsigned char> staging;
+            for (size_t offset = 0; offset + 16 <= size; offset += 16) {
+                staging.push_back(0x00);
+                staging.push_back(0x0E);
+                staging.insert(staging.end(), record.begin(), record.end());
+            }
+            ByteArray frame(staging.begin(), staging.end());
+            benchmark::DoNotOptimize(frame.data());
+        });
+    }
+
+    // the same frame written straight into a preallocated ByteArray
+    void BM_FrameViaWriter(benchmark::State& state)
+    {
+        const size_t size = arg_size(state);
+        const ByteArray record = make_array(14, 1);
+        measure(state, [&] {
+            ByteArray frame = ByteArray::create_with_prealloc(size);
+            {
+                ByteWriter writer(frame);
+                for (size_t offset = 0; offset + 16 <= size; offset += 16) {
+                    writer.write_integral<uint16_t>(14).write(record);
+                }
+            }
+            benchmark::DoNotOptimize(frame.data());
+        });
+    }
+
+    // a frame of 2 byte length prefixed records to parse
+    ByteArray make_frame(const size_t size)
+    {
+        ByteArray frame = ByteArray::create_with_prealloc(size);
+        const ByteArray record = make_array(14, 1);
+        ByteWriter writer(frame);
+        for (size_t offset = 0; offset + 16 <= size; offset += 16) {
+            writer.write_integral<uint16_t>(14).write(record);
+        }
+        return frame;
+    }
+
+    // parsing with at() per length byte and a copy of every record through the iterator constructor
+    void BM_ParseViaAt(benchmark::State& state)
+    {
+        const ByteArray frame = make_frame(arg_size(state));
+        measure(state, [&] {
+            size_t offset = 0;
+            unsigned char last = 0;
+            while (offset + 2 <= frame.size()) {
+                const size_t length = static_cast<size_t>(frame.at(offset)) << 8 | frame.at(offset + 1);
+                offset += 2;
+                const ByteArray record(frame.begin() + offset, frame.begin() + offset + length);
+                last ^= record.at(0);
+                offset += length;
+            }
+            benchmark::DoNotOptimize(last);
+        });
+    }
+
+    // the same records as views through ByteReader
+    void BM_ParseViaReader(benchmark::State& state)
+    {
+        const ByteArray frame = make_frame(arg_size(state));
+        measure(state, [&] {
+            ByteReader reader(frame);
+            unsigned char last = 0;
+            while (!reader.empty()) {
+                last ^= reader.read_prefixed<uint16_t>()[0];
+            }
+            benchmark::DoNotOptimize(last);
+        });
+    }
+
+    void BM_ResizeGrowShrink(benchmark::State& state)
+    {
+        ByteArray array = make_array(arg_size(state), 1);
+        const size_t size = array.size();
+        measure(state, [&] {
+            array.resize(size / 2, EZeroPadDir::LSB_PAD, false);
+            array.resize(size, EZeroPadDir::LSB_PAD, false);
+            benchmark::DoNotOptimize(array.data());
+        });
+    }
+
+    // ---- bitwise operations and comparison
+
+    void BM_XorOperator(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        const ByteArray b = make_array(arg_size(state), 2);
+        measure(state, [&] {
+            ByteArray out(a ^ b);
+            benchmark::DoNotOptimize(out.data());
+        });
+    }
+
+    void BM_XorAssign(benchmark::State& state)
+    {
+        ByteArray a = make_array(arg_size(state), 1);
+        const ByteArray b = make_array(arg_size(state), 2);
+        measure(state, [&] {
+            a ^= b;
+            benchmark::DoNotOptimize(a.data());
+        });
+    }
+
+    // XOR of a moved-from array, the result takes over its block
+    void BM_XorRvalue(benchmark::State& state)
+    {
+        ByteArray work = make_array(arg_size(state), 1);
+        const ByteArray b = make_array(arg_size(state), 2);
+        measure(state, [&] {
+            ByteArray out = std::move(work) ^ b;
+            work = std::move(out);
+            benchmark::DoNotOptimize(work.data());
+        });
+    }
+
+    void BM_XorInto(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        const ByteArray b = make_array(arg_size(state), 2);
+        ByteArray out;
+        measure(state, [&] {
+            ByteArray::xor_into(a, b, out);
+            benchmark::DoNotOptimize(out.data());
+        });
+    }
+
+    void BM_ComplementInto(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        ByteArray out;
+        measure(state, [&] {
+            ByteArray::complement_into(a, out);
+            benchmark::DoNotOptimize(out.data());
+        });
+    }
+
+    void BM_AndInto(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        const ByteArray b = make_array(arg_size(state), 2);
+        ByteArray out = ByteArray::create_with_prealloc(arg_size(state));
+        measure(state, [&] {
+            ByteArray::and_into(a, b, out);
+            benchmark::DoNotOptimize(out.data());
+        });
+    }
+
+    void BM_ShiftLeftAssign(benchmark::State& state)
+    {
+        ByteArray a = make_array(arg_size(state), 1);
+        measure(state, [&] {
+            a <<= 3;
+            benchmark::DoNotOptimize(a.data());
+        });
+    }
+
+    void BM_HammingDistance(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        const ByteArray b = make_array(arg_size(state), 2);
+        measure(state, [&] { benchmark::DoNotOptimize(hamming_distance(a, b)); });
+    }
+
+    void BM_Equals(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        const ByteArray b = a;
+        measure(state, [&] { benchmark::DoNotOptimize(a == b); });
+    }
+
+    void BM_SecureEquals(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        const ByteArray b = a;
+        measure(state, [&] { benchmark::DoNotOptimize(secure_equals(a, b)); });
+    }
+
+    // ---- random and wipe
+
+    void BM_FillRandom(benchmark::State& state)
+    {
+        ByteArray array(arg_size(state), 0x00);
+        const auto source = static_cast<ERandomSource>(state.range(1));
+        measure(state, [&] {
+            ByteArray::fill_random(array, source);
+            benchmark::DoNotOptimize(array.data());
+        });
+    }
+
+    void BM_CreateFromPrng(benchmark::State& state)
+    {
+        const size_t size = arg_size(state);
+        measure(state, [&] {
+            ByteArray array = ByteArray::create_from_prng(size, ERandomSource::THREAD_DRBG);
+            benchmark::DoNotOptimize(array.data());
+        });
+    }
+
+    // allocation, fill and verified wipe of a fresh array, the full life cycle of a key
+    void BM_CreateAndSecureWipe(benchmark::State& state)
+    {
+        const size_t size = arg_size(state);
+        measure(state, [&] {
+            ByteArray key(size, 0x5A);
+            benchmark::DoNotOptimize(key.secure_wipe());
+        });
+    }
+
+    // ---- internal kernels
+
+    void BM_OpsXor(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        const ByteArray b = make_array(arg_size(state), 2);
+        ByteStorage out;
+        measure(state, [&] {
+            ByteArrayOps::xor_op(a, b, out);
+            benchmark::DoNotOptimize(out.data());
+        });
+    }
+
+    void BM_OpsComplement(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        ByteStorage out;
+        measure(state, [&] {
+            ByteArrayOps::complement(a, out);
+            benchmark::DoNotOptimize(out.data());
+        });
+    }
+
+    void BM_OpsHexEncode(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        std::vector<char> out(a.size() * 2);
+        measure(state, [&] {
+            ByteArrayOps::hex_encode(a.data(), a.size(), out.data());
+            benchmark::DoNotOptimize(out.data());
+        });
+    }
+
+    void BM_OpsHexDecode(benchmark::State& state)
+    {
+        const std::string hex = make_array(arg_size(state), 1).as_hex_string();
+        std::vector<unsigned char> out(arg_size(state));
+        measure(state, [&] {
+            benchmark::DoNotOptimize(ByteArrayOps::hex_decode(hex, out.data()));
+        });
+    }
+
+    void BM_OpsSecureEquals(benchmark::State& state)
+    {
+        const ByteArray a = make_array(arg_size(state), 1);
+        const ByteArray b = a;
+        measure(state, [&] { benchmark::DoNotOptimize(ByteArrayOps::secure_equals(a, b)); });
+    }
+
+    // range(1) selects verification
+    void BM_SecureZeroBuffer(benchmark::State& state)
+    {
+        std::vector<unsigned char> buffer(arg_size(state), 0x5A);
+        const auto options = security::unsafe::SecureErase::Options(state.range(1) != 0);
+        measure(state, [&] {
+            benchmark::DoNotOptimize(security::unsafe::SecureErase::secure_zero_buffer(buffer.data(), buffer.size(), options));
+        });
+    }
+
+    // 8 byte conversions, range(0) is always 8
+    void BM_Uint64RoundTrip(benchmark::State& state)
+    {
+        uint64_t value = 0x0123456789ABCDEFull;
+        measure(state, [&] {
+            const ByteArray array = ByteArray::create_from_uint64(value);
+            value = array.as_64bit_uint() + 1;
+            benchmark::DoNotOptimize(value);
+        });
+    }
+
+    constexpr int64_t kMinSize = 8;
+    constexpr int64_t kMaxSize = 64 << 20;
+
+    void all_sizes(benchmark::internal::Benchmark* bench)
+    {
+        bench->RangeMultiplier(8)->Range(kMinSize, kMaxSize);
+    }
+
+    // with a second argument, every size for each of its values
+    void all_sizes_with(benchmark::internal::Benchmark* bench, const std::vector<int64_t>& values)
+    {
+        for (const int64_t value : values) {
+            for (int64_t size = kMinSize; size <= kMaxSize; size *= 8) {
+                bench->Args({size, value});
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_ConstructFilled)->Apply(all_sizes);
+BENCHMARK(BM_CopyConstruct)->Apply(all_sizes);
+BENCHMARK(BM_FanOutCopy)->Apply(all_sizes);
+BENCHMARK(BM_FanOutShared)->Apply(all_sizes);
+BENCHMARK(BM_MoveConstruct)->Apply(all_sizes);
+BENCHMARK(BM_ConstructFromHex)->Apply(all_sizes);
+BENCHMARK(BM_AsHexString)->Apply(all_sizes);
+BENCHMARK(BM_ToHexChars)->Apply(all_sizes);
+BENCHMARK(BM_ConcatCopy)->Apply(all_sizes);
+BENCHMARK(BM_FrameViaVector)->Apply(all_sizes);
+BENCHMARK(BM_FrameViaWriter)->Apply(all_sizes);
+BENCHMARK(BM_ParseViaAt)->Apply(all_sizes);
+BENCHMARK(BM_ParseViaReader)->Apply(all_sizes);
+BENCHMARK(BM_ResizeGrowShrink)->Apply(all_sizes);
+BENCHMARK(BM_XorOperator)->Apply(all_sizes);
+BENCHMARK(BM_XorAssign)->Apply(all_sizes);
+BENCHMARK(BM_XorRvalue)->Apply(all_sizes);
+BENCHMARK(BM_XorInto)->Apply(all_sizes);
+BENCHMARK(BM_ComplementInto)->Apply(all_sizes);
+BENCHMARK(BM_AndInto)->Apply(all_sizes);
+BENCHMARK(BM_ShiftLeftAssign)->Apply(all_sizes);
+BENCHMARK(BM_HammingDistance)->Apply(all_sizes);
+BENCHMARK(BM_Equals)->Apply(all_sizes);
+BENCHMARK(BM_SecureEquals)->Apply(all_sizes);
+BENCHMARK(BM_FillRandom)->Apply([](auto* bench) {
+    all_sizes_with(bench, {static_cast<int64_t>(ERandomSource::SYSTEM), static_cast<int64_t>(ERandomSource::THREAD_DRBG)});
+});
+// create_from_prng is capped at ByteArray::MAX_RANDOM_BYTES
+BENCHMARK(BM_CreateFromPrng)->RangeMultiplier(8)->Range(kMinSize, ByteArray::MAX_RANDOM_BYTES);
+BENCHMARK(BM_CreateAndSecureWipe)->Apply(all_sizes);
+BENCHMARK(BM_OpsXor)->Apply(all_sizes);
+BENCHMARK(BM_OpsComplement)->Apply(all_sizes);
+BENCHMARK(BM_OpsHexEncode)->Apply(all_sizes);
+BENCHMARK(BM_OpsHexDecode)->Apply(all_sizes);
+BENCHMARK(BM_OpsSecureEquals)->Apply(all_sizes);
+BENCHMARK(BM_SecureZeroBuffer)->Apply([](auto* bench) { all_sizes_with(bench, {0, 1}); });
+BENCHMARK(BM_Uint64RoundTrip)->Arg(8);
@@ -0,0 +1,93 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/security_ops.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+using jlizard::security::unsafe::SecureErase;
+
+namespace
+{
+    // The previous fallback erase: three byte-wise volatile passes, each followed by a fence
+    void legacy_fallback_erase(void* ptr, const size_t len)
+    {
+        volatile unsigned char* p = static_cast<volatile unsigned char*>(ptr);
+        for (size_t i = 0; i < len; ++i) p[i] = 0x00;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (size_t i = 0; i < len; ++i) p[i] = 0xFF;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (size_t i = 0; i < len; ++i) p[i] = 0x00;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    template <typename Erase>
+    void run_wipe_bench(benchmark::State& state, Erase&& erase)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        std::vector<unsigned char> buffer(size, 0x5A);
+        for (auto _ : state) {
+            erase(buffer.data(), buffer.size());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    }
+
+    void BM_WipeLegacyFallback(benchmark::State& state)
+    {
+        run_wipe_bench(state, legacy_fallback_erase);
+    }
+
+    // secure_wipe()'s default policy
+    void BM_WipeVerified(benchmark::State& state)
+    {
+        run_wipe_bench(state, [](void* p, const size_t n) {
+            benchmark::DoNotOptimize(SecureErase::secure_zero_buffer(p, n, SecureErase::Options(true)));
+        });
+    }
+
+    void BM_WipeUnverified(benchmark::State& state)
+    {
+        run_wipe_bench(state, [](void* p, const size_t n) {
+            benchmark::DoNotOptimize(SecureErase::secure_zero_buffer(p, n, SecureErase::Options(false)));
+        });
+    }
+
+    void BM_WipeMultiPass(benchmark::State& state)
+    {
+        run_wipe_bench(state, [](void* p, const size_t n) {
+            benchmark::DoNotOptimize(SecureErase::secure_zero_buffer(p, n, SecureErase::Options(true, true, true)));
+        });
+    }
+}
+
+BENCHMARK(BM_WipeLegacyFallback)->RangeMultiplier(16)->Range(32, 1 << 20);
+BENCHMARK(BM_WipeVerified)->RangeMultiplier(16)->Range(32, 1 << 20);
+BENCHMARK(BM_WipeUnverified)->RangeMultiplier(16)->Range(32, 1 << 20);
+BENCHMARK(BM_WipeMultiPass)->RangeMultiplier(16)->Range(32, 1 << 20);
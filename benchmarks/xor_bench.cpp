@@ -0,0 +1,190 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_array.h"
+#include "jlizard/byte_array_ops.h"
+#include "jlizard/xor_stream.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#include <x86intrin.h>
+#define BYTEAO_BENCH_HAS_TSC 1
+#endif
+
+using namespace jlizard;
+
+namespace
+{
+    template <typename Buffer>
+    Buffer make_buffer(const size_t size, const unsigned char seed)
+    {
+        Buffer buf(size, 0x00);
+        for (size_t i = 0; i < size; ++i) {
+            buf[i] = static_cast<unsigned char>(i * 31 + seed);
+        }
+        return buf;
+    }
+
+    // The pre-fusion algorithm: zero-fill followed by one XOR pass per operand
+    void legacy_three_pass_xor(const std::vector<unsigned char>& first, const std::vector<unsigned char>& second,
+                               std::vector<unsigned char>& out)
+    {
+        const size_t arr_size = std::max(first.size(), second.size());
+        out.resize(arr_size);
+        std::fill(out.begin(), out.end(), 0);
+
+        const size_t first_offset = arr_size - first.size();
+        const size_t second_offset = arr_size - second.size();
+        for (size_t i = 0; i < first.size(); i++) {
+            out[first_offset + i] ^= first[i];
+        }
+        for (size_t i = 0; i < second.size(); i++) {
+            out[second_offset + i] ^= second[i];
+        }
+    }
+
+    std::uint64_t read_cycles()
+    {
+#if defined(BYTEAO_BENCH_HAS_TSC)
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    // Runs the benched operation and reports bytes/second and (on x86) output bytes per TSC cycle
+    template <typename Buffer, typename Op>
+    void run_xor_bench(benchmark::State& state, const size_t second_size, Op&& op)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        const auto first = make_buffer<Buffer>(size, 1);
+        const auto second = make_buffer<Buffer>(second_size, 7);
+        Buffer out(size, 0x00);
+
+        const std::uint64_t start_cycles = read_cycles();
+        for (auto _ : state) {
+            op(first, second, out);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        const std::uint64_t cycles = read_cycles() - start_cycles;
+
+        const auto total_bytes = static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size);
+        state.SetBytesProcessed(total_bytes);
+        if (cycles > 0) {
+            state.counters["bytes/cycle"] = static_cast<double>(total_bytes) / static_cast<double>(cycles);
+        }
+    }
+
+    void BM_XorLegacyThreePass(benchmark::State& state)
+    {
+        run_xor_bench<std::vector<unsigned char>>(state, static_cast<size_t>(state.range(0)), legacy_three_pass_xor);
+    }
+
+    void BM_XorFused(benchmark::State& state)
+    {
+        run_xor_bench<ByteStorage>(state, static_cast<size_t>(state.range(0)),
+                      [](const auto& a, const auto& b, auto& out) { ByteArrayOps::xor_op(a, b, out); });
+    }
+
+    void BM_XorLegacyThreePassUnequal(benchmark::State& state)
+    {
+        run_xor_bench<std::vector<unsigned char>>(state, static_cast<size_t>(state.range(0)) / 2, legacy_three_pass_xor);
+    }
+
+    void BM_XorFusedUnequal(benchmark::State& state)
+    {
+        run_xor_bench<ByteStorage>(state, static_cast<size_t>(state.range(0)) / 2,
+                      [](const auto& a, const auto& b, auto& out) { ByteArrayOps::xor_op(a, b, out); });
+    }
+
+    // a ^ b ^ ~c evaluated step by step, one temporary and one memory pass per operator
+    void BM_MaskEager(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        const ByteArray a(ByteView(make_buffer<ByteStorage>(size, 1)));
+        const ByteArray b(ByteView(make_buffer<ByteStorage>(size, 7)));
+        const ByteArray c(ByteView(make_buffer<ByteStorage>(size, 13)));
+        ByteArray out;
+        for (auto _ : state) {
+            ByteArray not_c;
+            ByteArray::complement_into(c, not_c);
+            ByteArray a_xor_b;
+            ByteArray::xor_into(a, b, a_xor_b);
+            ByteArray::xor_into(a_xor_b, not_c, out);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    }
+
+    // the same mask through the lazy expression nodes, a single fused pass
+    void BM_MaskLazy(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        const ByteArray a(ByteView(make_buffer<ByteStorage>(size, 1)));
+        const ByteArray b(ByteView(make_buffer<ByteStorage>(size, 7)));
+        const ByteArray c(ByteView(make_buffer<ByteStorage>(size, 13)));
+        ByteArray out;
+        for (auto _ : state) {
+            out = a ^ b ^ ~c;
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    }
+
+    // the same amount of data pushed through XorStream in 64 KiB chunks against a 32 byte repeating key
+    void BM_XorStreamChunked(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0));
+        const ByteArray input(ByteView(make_buffer<ByteStorage>(size, 1)));
+        const ByteArray key(ByteView(make_buffer<ByteStorage>(32, 7)));
+        XorStream stream = XorStream::repeating(key);
+        ByteArray out;
+        constexpr size_t chunk = 64 * 1024;
+        for (auto _ : state) {
+            for (size_t offset = 0; offset < size; offset += chunk) {
+                stream.update(ByteView(input).subview(offset, chunk), out);
+                benchmark::DoNotOptimize(out.data());
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    }
+}
+
+BENCHMARK(BM_XorLegacyThreePass)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_XorFused)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_XorLegacyThreePassUnequal)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_XorFusedUnequal)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_MaskEager)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_MaskLazy)->RangeMultiplier(8)->Range(64, 4 << 20);
+BENCHMARK(BM_XorStreamChunked)->RangeMultiplier(8)->Range(64, 4 << 20);
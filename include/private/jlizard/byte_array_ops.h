@@ -25,8 +25,12 @@
  
 #ifndef BYTEARRAYOPS_H
 #define BYTEARRAYOPS_H
+#include <cstddef>
 #include <cstdint>
-#include <vector>
+#include <string_view>
+
+#include "jlizard/byte_storage.h"
+#include "jlizard/byte_view.h"
 
 
 namespace  jlizard {
@@ -36,7 +40,9 @@ namespace  jlizard {
         struct Unsafe
         {
             static void complement(const unsigned char* in,unsigned char* out,const size_t length);
-            // XOR operation for raw pointers (right-aligned logic)
+            // XOR operation for raw pointers (right-aligned logic). Single fused pass: the longer
+            // operand's prefix is copied, the overlap is XORed and any excess result bytes are zeroed.
+            // result must not overlap either operand. Does nothing if result_size is too small
             static void xor_op(const unsigned char* first, size_t first_size,
                        const unsigned char* second, size_t second_size,
                        unsigned char* result, size_t result_size);
@@ -50,32 +56,79 @@ namespace  jlizard {
         };
 
 
-        static std::vector<unsigned char> complement(const std::vector<unsigned char>& in);
+        static ByteStorage complement(const ByteView in);
 
-        static void complement(const std::vector<unsigned char>& in,
-                                std::vector<unsigned char>& out);
+        static void complement(const ByteView in,
+                                ByteStorage& out);
 
-        // XOR two vectors with right alignment
-        static void xor_op(const std::vector<unsigned char>& first_operand,
-                          const std::vector<unsigned char>& second_operand,
-                          std::vector<unsigned char>& result_out);
+        // XOR two byte buffers with right alignment, reusing result_out's storage when it is large enough.
+        // result_out must not alias either operand (use xor_assign for in-place XOR)
+        static void xor_op(const ByteView first_operand,
+                          const ByteView second_operand,
+                          ByteStorage& result_out);
 
-        // XOR a vector with a single byte
-        static void xor_op(const std::vector<unsigned char>& input,
+        // XOR a byte buffer with a single byte
+        static void xor_op(const ByteView input,
                           unsigned char byte,
-                          std::vector<unsigned char>& result_out);
-        // XOR a vector with a single byte by-copy
-        static std::vector<unsigned char> xor_op(const std::vector<unsigned char>& input,
+                          ByteStorage& result_out);
+        // XOR a byte buffer with a single byte by-copy
+        static ByteStorage xor_op(const ByteView input,
                           unsigned char byte);
 
-        // Return new vector as result of XOR operation
-        static std::vector<unsigned char> xor_op(const std::vector<unsigned char>& first_operand,
-                                               const std::vector<unsigned char>& second_operand);
+        // XOR an operand into a byte buffer in place (right-aligned). No allocation when inout is at least as
+        // long as the operand, otherwise inout grows to the operand's size with leading zeros first
+        static void xor_assign(ByteStorage& inout,
+                              const ByteView operand);
+
+        // XOR a single byte into the last byte of a buffer in place, an empty buffer becomes {byte}
+        static void xor_assign(ByteStorage& inout, unsigned char byte);
+
+        // Return new buffer as result of XOR operation
+        static ByteStorage xor_op(const ByteView first_operand,
+                                               const ByteView second_operand);
+
+        // AND, OR and ANDNOT (first & ~second) with the right alignment of xor_op: the shorter operand
+        // is implicitly zero-padded on the left. result_out must not alias either operand
+        static void and_op(const ByteView first_operand, const ByteView second_operand, ByteStorage& result_out);
+        static void or_op(const ByteView first_operand, const ByteView second_operand, ByteStorage& result_out);
+        static void andnot_op(const ByteView first_operand, const ByteView second_operand, ByteStorage& result_out);
+
+        // the in place forms, growing inout with leading zeros when the operand is longer like xor_assign
+        static void and_assign(ByteStorage& inout, const ByteView operand);
+        static void or_assign(ByteStorage& inout, const ByteView operand);
+        static void andnot_assign(ByteStorage& inout, const ByteView operand);
+
+        // Bit shifts of the whole buffer read as one big-endian number, the size is kept: left shifts
+        // move bits towards index 0 and shift zeros in at the end, right shifts the other way round.
+        // Shifting by size() * 8 bits or more clears every byte. out must not alias in
+        static void shift_left(const ByteView in, size_t bit_count, ByteStorage& out);
+        static void shift_right(const ByteView in, size_t bit_count, ByteStorage& out);
+        static void shift_left_assign(ByteStorage& inout, size_t bit_count) noexcept;
+        static void shift_right_assign(ByteStorage& inout, size_t bit_count) noexcept;
+
+        // Bit rotations of the whole buffer in place, bit_count is taken modulo size() * 8
+        static void rotate_left_assign(ByteStorage& inout, size_t bit_count) noexcept;
+        static void rotate_right_assign(ByteStorage& inout, size_t bit_count) noexcept;
+
+        // number of set bits
+        static uint64_t popcount(const ByteView in) noexcept;
+        // number of differing bits with right alignment, excess bytes of the longer operand count in full
+        static uint64_t hamming_distance(const ByteView first_operand, const ByteView second_operand) noexcept;
+
+        // constant time comparison: every byte of both operands is read whatever their contents,
+        // only a size mismatch returns early
+        static bool secure_equals(const ByteView first_operand, const ByteView second_operand) noexcept;
 
         // convert uint64 to byte array
-        static void uint64_to_bytearray(const uint64_t in,std::vector<unsigned char>& out);
+        static void uint64_to_bytearray(const uint64_t in,ByteStorage& out);
         //convert byte array to uint64 or return largest uint64 integer if byte array is to large
-        static uint64_t bytearray_to_uint64(const std::vector<unsigned char>& in);
+        static uint64_t bytearray_to_uint64(const ByteView in);
+
+        // write length bytes as 2 * length lowercase hex characters into out (no terminator)
+        static void hex_encode(const unsigned char* in, size_t length, char* out) noexcept;
+        // decode a hex string into out which must hold (hex.size() + 1) / 2 bytes, a trailing odd
+        // character is decoded as a single low nibble byte. Returns false on any non-hex character
+        static bool hex_decode(std::string_view hex, unsigned char* out) noexcept;
 
         ByteArrayOps() = delete;
     };
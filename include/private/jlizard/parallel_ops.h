@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef PARALLEL_OPS_H
+#define PARALLEL_OPS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @file parallel_ops.h
+ * @brief Size dispatched front ends of the simd kernels
+ *
+ * Each function has the contract of the simd::Kernels entry of the same name. Inputs below
+ * parallel::Config::threshold go straight to simd::active(), larger ones are cut into
+ * chunk_size pieces processed by the worker pool and the calling thread, each piece with the
+ * same simd kernel. The result is identical either way.
+ *
+ * Only one operation uses the pool at a time. A caller that finds it busy, a forked child and
+ * a build with BYTEAO_DISABLE_PARALLEL process the whole range on the calling thread.
+ */
+
+namespace jlizard::parallel
+{
+    void xor_bytes(const unsigned char* a, const unsigned char* b, unsigned char* out, size_t len) noexcept;
+    void complement_bytes(const unsigned char* in, unsigned char* out, size_t len) noexcept;
+    std::uint64_t diff_bytes(const unsigned char* a, const unsigned char* b, size_t len) noexcept;
+    std::uint64_t or_bytes(const unsigned char* in, size_t len) noexcept;
+    void and_bytes(const unsigned char* a, const unsigned char* b, unsigned char* out, size_t len) noexcept;
+    void bitor_bytes(const unsigned char* a, const unsigned char* b, unsigned char* out, size_t len) noexcept;
+    void andnot_bytes(const unsigned char* a, const unsigned char* b, unsigned char* out, size_t len) noexcept;
+    std::uint64_t popcount_bytes(const unsigned char* in, size_t len) noexcept;
+    std::uint64_t hamming_bytes(const unsigned char* a, const unsigned char* b, size_t len) noexcept;
+    // split across threads only when out and in do not overlap, the kernels' ordering guarantee
+    // for in place shifts does not hold between concurrently processed chunks
+    void shl_bits(const unsigned char* in, unsigned char* out, size_t len, unsigned bits, unsigned char next) noexcept;
+    void shr_bits(const unsigned char* in, unsigned char* out, size_t len, unsigned bits, unsigned char prev) noexcept;
+    // memcmp(a, b, len) == 0, with an early exit inside every chunk
+    bool equal_bytes(const unsigned char* a, const unsigned char* b, size_t len) noexcept;
+
+    /**
+     * @brief Calls body(begin, end) for consecutive pieces covering [0, len)
+     *
+     * Pieces run concurrently when len reaches the threshold, body must therefore be safe to
+     * call from several threads at once and must not throw.
+     */
+    void for_each_chunk(size_t len, const std::function<void(size_t begin, size_t end)>& body) noexcept;
+}
+
+#endif //PARALLEL_OPS_H
@@ -26,16 +26,11 @@
 #ifndef SECURITY_OPS_H
 #define SECURITY_OPS_H
 
-// FIXME: Enhance erasure security with a more complex multi-pattern approach
-// Consider implementing a 4-pass pattern with: 0x00, 0xFF, alternating 0xAA/0x55, and final 0x00
-// This provides better protection against sophisticated memory forensics techniques
-// Example implementation in secure_zero_raw_() function
-
-// FIXME: Add memory allocation tracking system for comprehensive sensitive data protection
-// Implement a thread_local registry to track sensitive allocations with automatic cleanup
-// This would ensure sensitive data is erased even in exceptional situations
-// Consider adding: register_sensitive_allocation() and cleanup_all_sensitive_allocations() methods
+// NOTE: Automatic erasure of sensitive allocations is provided by SecureMemoryResource
+// (jlizard/secure_memory_resource.h), which erases every block on deallocation and tracks the
+// number of live blocks and bytes
 
+#include <memory_resource>
 #include <vector>
 #include <stdexcept>
 
@@ -48,7 +43,10 @@
  * - Windows: Uses SecureZeroMemory (untested)
  * - macOS/iOS: Uses memset_s (untested)
  * - Linux with glibc ≥2.25: Uses explicit_bzero
- * - Other platforms: Uses a multi-pass volatile memory overwrite with memory barriers
+ * - Other platforms: Uses word wide volatile stores followed by a compiler barrier
+ *
+ * Options::multi_pass adds a 0x00, 0xFF, alternating 0xAA/0x55 overwrite before the final
+ * zeroing on every platform.
  *
  * @note The code for Windows and macOS is provided but has not been tested by the
  * developers. Community testing and feedback for these platforms is welcomed.
@@ -100,7 +98,7 @@ namespace jlizard::security::unsafe
          * - Windows: SecureZeroMemory
          * - macOS/iOS: memset_s
          * - Linux/Unix with modern glibc: explicit_bzero
-         * - Other platforms: Fallback to a multi-pass overwrite with memory barriers
+         * - Other platforms: Fallback to word wide volatile stores and a compiler barrier
          *
          * @param ptr Pointer to memory to be erased
          * @param len Length of memory in bytes
@@ -110,8 +108,9 @@ namespace jlizard::security::unsafe
         /**
          * @brief Verifies if memory has been zeroed out in constant time
          *
-         * This function checks each byte of memory without early return to
-         * prevent timing side-channel attacks.
+         * All bytes are ORed together a machine word or SIMD register at a time
+         * (see simd::Kernels::or_bytes), without early return to prevent timing
+         * side-channel attacks.
          *
          * @param ptr Pointer to memory to verify
          * @param len Length of memory in bytes
@@ -127,6 +126,7 @@ namespace jlizard::security::unsafe
         struct Options {
             bool verify_after_erase = false;  ///< Whether to verify memory is zeroed after erasure
             bool throw_on_verification_failure = true;  ///< Whether to throw on verification failure
+            bool multi_pass = false;  ///< Overwrite with 0x00, 0xFF and 0xAA/0x55 before the final zeroing
 
             /**
              * @brief Construct options with default settings
@@ -138,10 +138,12 @@ namespace jlizard::security::unsafe
              *
              * @param verify Enable verification after erasure
              * @param throw_on_failure Throw exception on verification failure
+             * @param multi_pass Overwrite with several patterns before the final zeroing
              */
-            explicit Options(bool verify, bool throw_on_failure = true)
+            explicit Options(bool verify, bool throw_on_failure = true, bool multi_pass = false)
                 : verify_after_erase(verify),
-                  throw_on_verification_failure(throw_on_failure) {}
+                  throw_on_verification_failure(throw_on_failure),
+                  multi_pass(multi_pass) {}
         };
 
         /**
@@ -166,6 +168,20 @@ namespace jlizard::security::unsafe
         template<typename T>
         static bool secure_zero(T& obj, const Options& options = Options());
 
+        /**
+         * @brief Securely zeros a raw memory region
+         *
+         * Used for buffers that are not owned by a std::vector, such as ByteStorage's inline
+         * small buffer or its heap block. The memory is not deallocated.
+         *
+         * @param ptr Pointer to the memory to erase, may be null if len is zero
+         * @param len Length of the memory region in bytes
+         * @param options Configuration options for this operation
+         * @return bool True if verification succeeded or wasn't requested, false if verification failed
+         * @throws ErasureVerificationError If verification fails and throwing is enabled
+         */
+        static bool secure_zero_buffer(void* ptr, size_t len, const Options& options);
+
         /**
          * @brief Securely zeros a vector of trivially copyable objects and deallocates its memory
          *
@@ -173,7 +189,12 @@ namespace jlizard::security::unsafe
          * deallocation by swapping with an empty vector. This method should be used for vectors
          * instead of the generic secure_zero method.
          *
+         * Works with any allocator: the memory is erased in place before it is handed back to
+         * the vector's allocator (e.g. a std::pmr::memory_resource), and the replacement empty
+         * vector keeps that allocator.
+         *
          * @tparam T Element type (must be trivially copyable)
+         * @tparam Alloc Allocator type of the vector
          * @param vec Vector to securely erase
          * @param options Configuration options for this operation
          * @return bool True if verification succeeded or wasn't requested, false if verification failed
@@ -186,13 +207,19 @@ namespace jlizard::security::unsafe
          *     unsafe::SecureErase::Options(true));
          * @endcode
          */
-        template<typename T>
-        static bool secure_zero_vector(std::vector<T>& vec, const Options& options = Options());
+        template<typename T, typename Alloc>
+        static bool secure_zero_vector(std::vector<T, Alloc>& vec, const Options& options = Options());
         
         /**
          * @brief Prevents instantiation of this utility class
          */
         SecureErase() = delete;
+
+    private:
+        // Runs the extra overwrite passes requested by options, then secure_zero_raw_
+        static void erase_(void* ptr, size_t len, const Options& options);
+        // erase_ over [ptr, ptr + len), split across cores for buffers past parallel::Config::threshold
+        static void erase_parallel_(void* ptr, size_t len, const Options& options);
     };
 }
 
@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file simd_kernels.h
+ * @brief Runtime-dispatched bulk byte kernels used by ByteArrayOps
+ *
+ * @section dispatch Dispatch
+ * The kernel table is selected once, on first use, based on the features
+ * reported by the running CPU:
+ * - x86-64: AVX-512F, AVX2 or SSE2 (SSE2 is always available on x86-64)
+ * - AArch64: NEON
+ * - Everything else (or when built with BYTEAO_DISABLE_SIMD): a portable scalar loop
+ *
+ * Built with BYTEAO_NATIVE_ARCH (-march=native), x86-64 skips the detection and uses the
+ * widest instruction set enabled at compile time.
+ *
+ * All kernels operate on plain, equally sized byte ranges. Any alignment semantics
+ * (e.g. the right-aligned XOR of ByteArrayOps::xor_op) are handled by the caller.
+ */
+
+namespace jlizard::simd
+{
+    /**
+     * @brief Table of bulk byte kernels for one instruction set
+     *
+     * Every kernel tolerates `out` aliasing one of its inputs exactly (in-place use),
+     * but not partially overlapping ranges.
+     */
+    struct Kernels
+    {
+        /// out[i] = a[i] ^ b[i] for i in [0, len)
+        void (*xor_bytes)(const unsigned char* a, const unsigned char* b, unsigned char* out, size_t len);
+        /// out[i] = ~in[i] for i in [0, len)
+        void (*complement_bytes)(const unsigned char* in, unsigned char* out, size_t len);
+        /// Bitwise OR of a[i] ^ b[i] over [0, len), zero iff the ranges are equal. Runs in
+        /// time depending only on len, there is no early exit
+        std::uint64_t (*diff_bytes)(const unsigned char* a, const unsigned char* b, size_t len);
+        /// Bitwise OR of in[i] over [0, len), zero iff the range is all zero. Constant time like diff_bytes
+        std::uint64_t (*or_bytes)(const unsigned char* in, size_t len);
+        /// out[i] = a[i] & b[i] for i in [0, len)
+        void (*and_bytes)(const unsigned char* a, const unsigned char* b, unsigned char* out, size_t len);
+        /// out[i] = a[i] | b[i] for i in [0, len), the element-wise counterpart of the or_bytes reduction
+        void (*bitor_bytes)(const unsigned char* a, const unsigned char* b, unsigned char* out, size_t len);
+        /// out[i] = a[i] & ~b[i] for i in [0, len)
+        void (*andnot_bytes)(const unsigned char* a, const unsigned char* b, unsigned char* out, size_t len);
+        /// Number of set bits in [0, len)
+        std::uint64_t (*popcount_bytes)(const unsigned char* in, size_t len);
+        /// Number of set bits of a[i] ^ b[i] over [0, len), the Hamming distance of the ranges
+        std::uint64_t (*hamming_bytes)(const unsigned char* a, const unsigned char* b, size_t len);
+        /// out[i] = in[i] << bits | in[i + 1] >> (8 - bits) for i in [0, len), `next` standing in for
+        /// in[len]; bits in [1, 7]. Runs front to back, so out may also start before in
+        void (*shl_bits)(const unsigned char* in, unsigned char* out, size_t len, unsigned bits, unsigned char next);
+        /// out[i] = in[i] >> bits | in[i - 1] << (8 - bits) for i in [0, len), `prev` standing in for
+        /// in[-1]; bits in [1, 7]. Runs back to front, so out may also start after in
+        void (*shr_bits)(const unsigned char* in, unsigned char* out, size_t len, unsigned bits, unsigned char prev);
+        /// Human readable name of the selected instruction set (e.g. "avx2")
+        const char* name;
+    };
+
+    /**
+     * @brief Returns the kernel table selected for the running CPU
+     *
+     * Detection happens exactly once; subsequent calls return the cached table.
+     */
+    const Kernels& active() noexcept;
+
+    /**
+     * @brief Returns the portable scalar kernel table regardless of CPU features
+     */
+    const Kernels& scalar() noexcept;
+}
+
+#endif //SIMD_KERNELS_H
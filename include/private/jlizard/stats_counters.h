@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef STATS_COUNTERS_H
+#define STATS_COUNTERS_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @file stats_counters.h
+ * @brief Counting side of jlizard/stats.h
+ *
+ * JLBA_STAT_ADD(field, n) adds n to a field of stats::Counters in the calling thread's block.
+ * It compiles to nothing unless the library is built with BYTEAO_ENABLE_STATS.
+ */
+
+namespace jlizard::stats::detail
+{
+    // one writer (the owning thread), any number of readers (snapshots)
+    class Counter
+    {
+    public:
+        void add(const std::uint64_t n) noexcept
+        {
+            // a plain load and store instead of an atomic read-modify-write, only the owner writes
+            value_.store(value_.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+        [[nodiscard]] std::uint64_t load() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<std::uint64_t> value_{0};
+    };
+
+    struct ThreadCounters
+    {
+        Counter allocations;
+        Counter allocated_bytes;
+        Counter deallocations;
+        Counter reallocations;
+        Counter copies;
+        Counter bytes_copied;
+        Counter wipes;
+        Counter bytes_wiped;
+        Counter verify_failures;
+    };
+
+    // the calling thread's block, registered for snapshot() on first use
+    ThreadCounters& local() noexcept;
+}
+
+#if defined(BYTEAO_ENABLE_STATS)
+#define JLBA_STAT_ADD(field, n) ::jlizard::stats::detail::local().field.add(static_cast<std::uint64_t>(n))
+#else
+#define JLBA_STAT_ADD(field, n) ((void)0)
+#endif
+
+#endif //STATS_COUNTERS_H
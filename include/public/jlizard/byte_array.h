@@ -26,17 +26,25 @@
 #ifndef BYTE_ARRAY_H
 #define BYTE_ARRAY_H
 
-#define JLBA_DEFAULT_ALLOC_SIZE 32
-
+#include <charconv>
 #include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
 #include <stdexcept>
 #include <vector>
 #include <string>
 
+#include "jlizard/byte_storage.h"
+#include "jlizard/debug_assert.h"
+#include "jlizard/byte_view.h"
+#include "jlizard/byte_expr.h"
+#include "jlizard/random.h"
+
+// Kept for source compatibility, a default constructed ByteArray now holds this many bytes inline
+#define JLBA_DEFAULT_ALLOC_SIZE JLBA_INLINE_CAPACITY
+
 //FIXME create overloads for xor and complement
-//FIXME iterator for transparently pushing bytes
-//FIXME create Unsafe block for raw pointer op
-//FIXME use SIMD
 //FIXME add uint64_t constructor
 //FIXME add boolean flag for automatic secure wipe operation
 namespace jlizard
@@ -73,6 +81,21 @@ namespace jlizard
         DEFAULT_PAD = LSB_PAD
     };
 
+    /**
+     * @brief How ByteArray::secure_wipe() erases the buffer
+     *
+     * The default erases once with the platform primitive and verifies the result, which
+     * is what secure_wipe() has always done. Large pools of short-lived keys can drop the
+     * verification; multi_pass adds a 0x00, 0xFF, 0xAA/0x55 overwrite before the final zeroing.
+     */
+    struct SecureWipePolicy
+    {
+        bool verify = true;       ///< read the erased buffer back and check it is all zero
+        bool multi_pass = false;  ///< overwrite with several patterns before the final zeroing
+
+        constexpr bool operator==(const SecureWipePolicy&) const noexcept = default;
+    };
+
 
     /**
      * @class ByteArray
@@ -82,12 +105,40 @@ namespace jlizard
     class ByteArray
     {
     private:
-        std::vector<unsigned char> bytes_;
+        // write straight into the storage of their output arrays
+        friend class ByteChain;
+        friend class XorStream;
+        friend class ByteWriter;
+
+        ByteStorage bytes_;
+        SecureWipePolicy wipe_policy_;
+
+        // adopts an already filled storage, used by the operators to avoid copying their results
+        explicit ByteArray(ByteStorage&& storage) noexcept : bytes_(std::move(storage)) {}
+
+        // evaluates a lazy expression into this array in a single pass
+        template <typename Expr>
+        void assign_expression_(const Expr& expression);
+
+        // erases [first, first + count) of this array's block according to the wipe policy
+        bool wipe_range_(unsigned char* first, size_t count);
+        // grows past the capacity into a new exact-size block in a single copy, wiping the old block if purge is set
+        void grow_into_new_block_(size_t new_size, EZeroPadDir zero_pad_dir, bool purge);
+        // the kernel path of operator^=(ByteView), taken for long or longer operands
+        ByteArray& xor_assign_(ByteView other);
     public:
+        using value_type = unsigned char;
+        using iterator = unsigned char*;
+        using const_iterator = const unsigned char*;
+        using allocator_type = std::pmr::polymorphic_allocator<unsigned char>;
+
+        // Number of bytes stored inline without a heap allocation (see JLBA_INLINE_CAPACITY)
+        static constexpr size_t INLINE_CAPACITY = ByteStorage::inline_capacity;
+
         // Maximum size for random byte generation (1 MB)
         static constexpr size_t MAX_RANDOM_BYTES = 1024 * 1024;
 
-        // Destructor - likely trivial since std::vector handles cleanup
+        // Destructor - trivial since ByteStorage handles cleanup
         ~ByteArray() = default;
         ByteArray(const ByteArray& other) = default;
         /**
@@ -131,34 +182,96 @@ namespace jlizard
         ByteArray(const ByteArray& other,const size_t num_bytes,const EZeroPadDir zero_pad_dir = EZeroPadDir::DEFAULT_PAD);
         /**
          * @brief Move constructor with truncation/padding
-         * @param other ByteArray to move from
+         *
+         * Takes over other's storage and truncates or pads it in place, so no allocation
+         * happens unless padding exceeds the capacity. Bytes cut off by truncation are
+         * securely erased (according to other's wipe policy) since they stay in the block.
+         *
+         * @param other ByteArray to move from, empty afterwards
          * @param num_bytes Target size for truncation or padding
          * @param zero_pad_dir Padding direction when size needs to be increased
          * @see ByteArray(const ByteArray&, size_t, EZeroPadDir)
          */
-        ByteArray(ByteArray&& other,const size_t num_bytes,const EZeroPadDir zero_pad_dir = EZeroPadDir::DEFAULT_PAD) : ByteArray(other,num_bytes,zero_pad_dir) {};
+        ByteArray(ByteArray&& other,const size_t num_bytes,const EZeroPadDir zero_pad_dir = EZeroPadDir::DEFAULT_PAD);
+        /**
+         * @brief Copy assignment, keeps this array's memory resource
+         */
         ByteArray& operator=(const ByteArray& other) = default;
-        ByteArray(ByteArray&& other) noexcept : bytes_(std::move(other.bytes_)) {}
-        ByteArray& operator=(ByteArray&& other) noexcept;
+        /**
+         * @brief Move constructor, takes over other's storage and memory resource
+         */
+        ByteArray(ByteArray&& other) noexcept : bytes_(std::move(other.bytes_)), wipe_policy_(other.wipe_policy_) {}
+        /**
+         * @brief Move assignment, keeps this array's memory resource
+         *
+         * The heap block is taken over when both arrays use equal resources, otherwise the
+         * bytes are copied into this array's resource (which may throw std::bad_alloc).
+         */
+        ByteArray& operator=(ByteArray&& other);
         //FIXME collect all unit test utilities together
-        ByteArray() {bytes_.reserve(JLBA_DEFAULT_ALLOC_SIZE);};
-        explicit ByteArray(const std::vector<unsigned char>& byte_array): bytes_(byte_array) {};
-        explicit ByteArray(std::vector<unsigned char>&& byte_array) noexcept : bytes_(std::move(byte_array)) {};
+        /**
+         * @brief Constructs an empty ByteArray
+         *
+         * Does not allocate, up to INLINE_CAPACITY bytes are stored inside the object itself.
+         */
+        ByteArray() noexcept = default;
+        /**
+         * @brief Constructs an empty ByteArray that allocates from the given memory resource
+         *
+         * Any heap storage this array needs from now on (arrays larger than INLINE_CAPACITY)
+         * is obtained from the allocator's memory resource, e.g. a per-request
+         * std::pmr::monotonic_buffer_resource or a thread-local std::pmr::unsynchronized_pool_resource.
+         * The resource must outlive the ByteArray.
+         *
+         * @param alloc The allocator (or memory resource pointer) to allocate from
+         *
+         * @example
+         * std::array<std::byte, 4096> buffer;
+         * std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+         * ByteArray frame(&arena);
+         * frame.concat(header).concat(payload); // allocates from the arena
+         */
+        explicit ByteArray(const allocator_type& alloc) noexcept : bytes_(alloc.resource()) {}
+        /**
+         * @brief Copies another ByteArray into storage from the given memory resource
+         *
+         * The plain copy constructor uses the default resource, like the std::pmr containers.
+         *
+         * @param other The ByteArray to copy
+         * @param alloc The allocator (or memory resource pointer) to allocate from
+         */
+        ByteArray(const ByteArray& other, const allocator_type& alloc)
+            : bytes_(other.bytes_, alloc.resource()), wipe_policy_(other.wipe_policy_) {}
+        explicit ByteArray(const std::vector<unsigned char>& byte_array): bytes_(byte_array.data(), byte_array.size()) {};
+        /**
+         * @brief Constructs a ByteArray from a vector, securely wiping the source
+         *
+         * The bytes are copied into the ByteArray's own storage and the source vector is then
+         * securely erased and left empty, so no second copy of the data stays behind.
+         *
+         * @param byte_array The vector to take the bytes from, empty afterwards
+         */
+        explicit ByteArray(std::vector<unsigned char>&& byte_array);
         explicit ByteArray(const size_t num_bytes, const unsigned char val) noexcept : bytes_(num_bytes,val) {};
         /**
          * @brief Constructs a ByteArray with contents from an iterator range.
          *
          * Creates a ByteArray with copies of elements in the range [first, last).
-         * This constructor is restricted to only work with std::vector<unsigned char> iterators.
+         * This constructor is restricted to only work with std::vector<unsigned char> iterators
+         * and ByteArray iterators (raw byte pointers).
          *
-         * @tparam InputIt Iterator type, restricted to std::vector<unsigned char>::iterator or const_iterator
+         * @tparam InputIt Iterator type, restricted to std::vector<unsigned char>::iterator or const_iterator,
+         *         ByteArray::iterator or ByteArray::const_iterator
          * @param first Iterator to the beginning of the range
          * @param last Iterator to the end of the range
          */
         template <typename InputIt>
         requires std::same_as<InputIt, std::vector<unsigned char>::iterator> ||
-                 std::same_as<InputIt, std::vector<unsigned char>::const_iterator>
-        explicit ByteArray(InputIt first, InputIt last) : bytes_(first, last) {}
+                 std::same_as<InputIt, std::vector<unsigned char>::const_iterator> ||
+                 std::same_as<InputIt, iterator> ||
+                 std::same_as<InputIt, const_iterator>
+        explicit ByteArray(InputIt first, InputIt last)
+            : bytes_(std::to_address(first), static_cast<size_t>(last - first)) {}
 
 
         /**
@@ -169,35 +282,160 @@ namespace jlizard
         explicit ByteArray(T byte): bytes_(1,byte) {};
         /**
          * @brief Takes a string hex input and converts it to a byte array
-         * @param hex_str
-         * @param do_secure_wipe
+         *
+         * Both lower and upper case digits are accepted. For an odd number of characters
+         * the last character is decoded as a byte of its own (e.g. "abc" -> {0xab, 0x0c}).
+         *
+         * @param hex_str The hexadecimal string to decode, without prefix or separators
+         * @throws std::runtime_error If hex_str contains a non-hexadecimal character
          */
         explicit ByteArray(const std::string_view hex_str);
         /**
          * @brief Construct a ByteArray from an initializer list of bytes
          * @param bytes The initializer list of unsigned char values
          */
-        ByteArray(const std::initializer_list<unsigned char> bytes) : bytes_(bytes) {};
+        ByteArray(const std::initializer_list<unsigned char> bytes) : bytes_(bytes.begin(), bytes.size()) {};
+        /**
+         * @brief Copies the bytes of a view (e.g. a slice of a larger buffer) into a new ByteArray
+         * @param view The bytes to copy
+         */
+        explicit ByteArray(const ByteView view) : bytes_(view.data(), view.size()) {}
+        /**
+         * @brief Evaluates a lazy bitwise expression such as `a ^ b ^ ~c` in a single fused pass
+         *
+         * Implicit so that `ByteArray mask = a ^ b ^ ~c;` works as before the operators became lazy.
+         *
+         * @see byte_expr.h
+         */
+        template <typename Expr>
+            requires expr::is_expression_v<Expr>
+        ByteArray(const Expr& expression) // NOLINT(google-explicit-constructor)
+        {
+            assign_expression_(expression);
+        }
+        /**
+         * @brief Evaluates a lazy bitwise expression into this array, reusing its storage
+         *
+         * Operands may refer to this array itself, e.g. `a = a ^ b ^ ~c` runs in place.
+         */
+        template <typename Expr>
+            requires expr::is_expression_v<Expr>
+        ByteArray& operator=(const Expr& expression)
+        {
+            assign_expression_(expression);
+            return *this;
+        }
 
         /**
+         * @brief Securely erases the contents and releases the storage
+         *
+         * The whole buffer, including unused capacity and the inline small buffer, is erased
+         * (and verified, unless the wipe policy turns that off) before any heap block is freed.
+         * The ByteArray is empty afterwards. clear() and purging resizes wipe the same way.
+         *
+         * For arrays allocating from a SecureMemoryResource the storage is simply released:
+         * the resource erases the heap block and the inline buffer is erased on release. Only
+         * a multi-pass policy adds an explicit erase first.
+         *
+         * @return true if the erasure was verified or verification is turned off
+         * @throws security::unsafe::ErasureVerificationError If verification fails
          *
-         * @return
+         * @see set_wipe_policy
          */
         bool secure_wipe();
 
         /**
-         * Concatenates a byte array to the end of this one (modifies this object)
-         * @param other The byte array to append to this array
+         * @brief Sets how secure_wipe() erases this array, the policy is copied and moved with it
+         *
+         * @example
+         * ByteArray session_key = ByteArray::create_from_prng(32);
+         * session_key.set_wipe_policy({.verify = false});   // teardown of large key pools
+         */
+        void set_wipe_policy(const SecureWipePolicy policy) noexcept { wipe_policy_ = policy; }
+        [[nodiscard]] SecureWipePolicy wipe_policy() const noexcept { return wipe_policy_; }
+
+        /**
+         * Concatenates bytes to the end of this array (modifies this object)
+         * @param other The bytes to append to this array, may view this array itself
          * @return Reference to this ByteArray for method chaining
          */
-        ByteArray& concat(const ByteArray& other);
+        ByteArray& concat(ByteView other);
 
         /**
          * Creates a new ByteArray by concatenating this array with another
-         * @param other The byte array to append to a copy of this array
+         * @param other The bytes to append to a copy of this array
          * @return New ByteArray containing this array's data followed by other's data
          */
-        [[nodiscard]] ByteArray concat_copy(const ByteArray& other) const;
+        [[nodiscard]] ByteArray concat_copy(ByteView other) const&;
+        // concat_copy of a temporary, appends to the temporary's storage and moves it out
+        [[nodiscard]] ByteArray concat_copy(ByteView other) &&;
+
+        /**
+         * @brief Appends one byte, growing the capacity geometrically (amortised O(1))
+         *
+         * Together with value_type this makes ByteArray usable with std::back_inserter.
+         *
+         * @example
+         * ByteArray frame = ByteArray::create_with_prealloc(64);
+         * std::copy(header.begin(), header.end(), std::back_inserter(frame));
+         */
+        void push_back(unsigned char byte) { bytes_.push_back(byte); }
+
+        /**
+         * @brief Appends bytes to the end of this array, the same as concat()
+         * @param other The bytes to append, may view this array itself
+         * @return Reference to this ByteArray for method chaining
+         */
+        ByteArray& append(const ByteView other) { return concat(other); }
+
+        /**
+         * @brief Appends `size` bytes read from a raw buffer
+         * @param data Start of the bytes to append, may be null if size is 0
+         * @param size Number of bytes to append
+         * @return Reference to this ByteArray for method chaining
+         */
+        ByteArray& append(const void* data, size_t size);
+
+        /**
+         * @brief Appends the sizeof(T) byte encoding of an unsigned integer
+         *
+         * @tparam T Unsigned integer type (uint8_t ... uint64_t, unsigned __int128 where available)
+         * @tparam Order Byte order of the appended bytes, network order (MSB first) by default
+         *
+         * @example
+         * frame.append_integral<uint16_t>(payload.size()).append(payload);
+         */
+        template <CodecIntegral T, EByteOrder Order = EByteOrder::NETWORK>
+        ByteArray& append_integral(const T value)
+        {
+            const size_t offset = bytes_.size();
+            bytes_.resize_uninitialized(offset + sizeof(T));
+            byte_order::store<Order>(value, bytes_.data() + offset);
+            return *this;
+        }
+
+        /**
+         * @brief Inserts bytes before position `pos`, shifting the following bytes right
+         * @param pos Insertion point, 0 to size()
+         * @param other The bytes to insert, may view this array itself
+         * @return Reference to this ByteArray for method chaining
+         * @throws std::out_of_range If pos > size()
+         */
+        ByteArray& insert(size_t pos, ByteView other);
+
+        /**
+         * @brief Inserts bytes at the front of this array, the same as insert(0, other)
+         * @param other The bytes to prepend, may view this array itself
+         * @return Reference to this ByteArray for method chaining
+         */
+        ByteArray& prepend(const ByteView other) { return insert(0, other); }
+
+        /**
+         * @brief Ensures capacity() >= new_capacity, never shrinks and never changes the contents
+         *
+         * @see create_with_prealloc
+         */
+        void reserve(const size_t new_capacity) { bytes_.reserve(new_capacity); }
 
 
 
@@ -205,23 +443,206 @@ namespace jlizard
 
 
         // Logical Operations Begin
-        // XOR-assignment operator
-        ByteArray& operator^=(const ByteArray& other);
+        /**
+         * @brief XOR-assignment operator (right-aligned, in place)
+         *
+         * When this array is at least as long as `other` the operation runs in a single
+         * pass over the rightmost `other.size()` bytes without allocating. When `other` is
+         * longer, this array first grows to `other.size()` by prepending zeros, so the result
+         * is identical to `*this ^ other`.
+         *
+         * @param other The bytes to XOR into this one, may view this array itself (a view of any
+         *        part other than the right-aligned tail is copied first)
+         * @return Reference to this ByteArray
+         */
+        ByteArray& operator^=(ByteView other);
 
-        // XOR with another ByteArray, returning a new ByteArray
-        ByteArray operator^(const ByteArray& other) const;
+        // XOR-assignment with a lazy expression, evaluated in place in a single pass
+        template <typename Expr>
+            requires expr::is_expression_v<Expr>
+        ByteArray& operator^=(const Expr& expression)
+        {
+            assign_expression_(expr::Xor(expr::Leaf(*this), expression));
+            return *this;
+        }
+
+        /**
+         * @brief XOR with another ByteArray or ByteView (right-aligned)
+         *
+         * Returns a lazy expression node that is evaluated when it is assigned to a ByteArray,
+         * so chains like `a ^ b ^ ~c` run in one pass without temporaries.
+         */
+        [[nodiscard]] expr::Xor<expr::Leaf, expr::Leaf> operator^(const ByteView other) const noexcept
+        {
+            return {expr::Leaf(*this), expr::Leaf(other)};
+        }
+
+        /**
+         * @brief XOR of a temporary or moved-from array, evaluated eagerly in its storage
+         *
+         * `std::move(a) ^ b` and `ByteArray(x) ^ b` run `^=` on the left operand and move it
+         * into the result, so chains of temporaries do not allocate as long as the left
+         * operand's capacity covers the result.
+         */
+        [[nodiscard]] friend ByteArray operator^(ByteArray&& lhs, const ByteView rhs)
+        {
+            lhs ^= rhs;
+            return std::move(lhs);
+        }
 
         // XOR with a single byte, returning a new ByteArray
-        ByteArray operator^(unsigned char byte) const;
+        ByteArray operator^(unsigned char byte) const&;
+        // XOR of a temporary with a single byte, in its storage
+        ByteArray operator^(unsigned char byte) &&;
 
-        // XOR-assignment with a single byte
+        // XOR-assignment with a single byte (in place on the last byte, an empty array becomes {byte})
         ByteArray& operator^=(unsigned char byte);
 
-        // 1's complement operator (unary ~)
-        ByteArray operator~() const;
+        // 1's complement operator (unary ~), returns a lazy expression node like operator^
+        [[nodiscard]] expr::Not<expr::Leaf> operator~() const& noexcept
+        {
+            return expr::Not(expr::Leaf(*this));
+        }
+
+        /**
+         * @brief 1's complement of a temporary, computed in place in its storage
+         * @throws std::invalid_argument If the array is empty
+         */
+        [[nodiscard]] ByteArray operator~() &&;
+
+        /**
+         * @brief AND, OR and AND-NOT assignment (right-aligned, in place)
+         *
+         * The shorter operand is implicitly zero-padded on the left as for operator^=, so an
+         * array longer than `other` keeps its leading bytes under `|=` and `andnot_assign()`
+         * and has them cleared under `&=`. When `other` is longer this array first grows to
+         * its size with leading zeros.
+         *
+         * @param other The operand, may view this array itself
+         * @return Reference to this ByteArray
+         *
+         * @example
+         * bitmap &= filter;                 // keep the bits set in both
+         * bitmap.andnot_assign(revoked);    // clear the bits set in revoked
+         */
+        ByteArray& operator&=(ByteView other);
+        ByteArray& operator|=(ByteView other);
+        // this &= ~mask, clears every bit set in mask
+        ByteArray& andnot_assign(ByteView mask);
+
+        // AND and OR (right-aligned), evaluated eagerly into a new array
+        [[nodiscard]] ByteArray operator&(ByteView other) const&;
+        [[nodiscard]] ByteArray operator|(ByteView other) const&;
+        // AND and OR of a temporary, in its storage
+        [[nodiscard]] ByteArray operator&(ByteView other) &&;
+        [[nodiscard]] ByteArray operator|(ByteView other) &&;
+
+        /**
+         * @brief Writes a & b, a | b or a & ~b (right-aligned) into an existing ByteArray
+         *
+         * The counterparts of xor_into(): `out`'s storage is reused and operands may view `out`.
+         */
+        static void and_into(ByteView a, ByteView b, ByteArray& out);
+        static void or_into(ByteView a, ByteView b, ByteArray& out);
+        static void andnot_into(ByteView a, ByteView b, ByteArray& out);
+
+        /**
+         * @brief Bit shifts of the whole array, read as one big-endian number
+         *
+         * The size never changes: `<<` moves bits towards index 0 and shifts zeros in at the
+         * end, `>>` moves them towards the last byte and shifts zeros in at the front. Bits
+         * shifted out are dropped, shifting by 8 * size() bits or more clears the array.
+         *
+         * @example
+         * ByteArray word({0x12, 0x34});
+         * word <<= 4;                       // {0x23, 0x40}
+         * ByteArray halves = word >> 8;     // {0x00, 0x23}
+         */
+        ByteArray& operator<<=(size_t bit_count) noexcept;
+        ByteArray& operator>>=(size_t bit_count) noexcept;
+        [[nodiscard]] ByteArray operator<<(size_t bit_count) const&;
+        [[nodiscard]] ByteArray operator>>(size_t bit_count) const&;
+        [[nodiscard]] ByteArray operator<<(size_t bit_count) &&;
+        [[nodiscard]] ByteArray operator>>(size_t bit_count) &&;
+
+        // writes input shifted by bit_count into out, reusing out's storage; input may view out
+        static void shift_left_into(ByteView input, size_t bit_count, ByteArray& out);
+        static void shift_right_into(ByteView input, size_t bit_count, ByteArray& out);
+
+        /**
+         * @brief Rotates the whole array in place by bit_count bits (modulo 8 * size())
+         *
+         * rotate_left() moves bits towards index 0, the bits leaving the first byte re-enter
+         * at the end of the last one; rotate_right() is the inverse.
+         */
+        ByteArray& rotate_left(size_t bit_count) noexcept;
+        ByteArray& rotate_right(size_t bit_count) noexcept;
+
+        // Comparison operators, the ByteArray overload keeps a == b unambiguous under C++20 reversed candidates
+        bool operator==(const ByteArray& other) const noexcept { return ByteView(*this) == ByteView(other); }
+        bool operator==(const ByteView other) const noexcept { return ByteView(*this) == other; }
+
+        /**
+         * @brief XORs two operands (right-aligned) into an existing ByteArray
+         *
+         * Same result as `out = a ^ b`, but `out`'s storage is reused: no allocation happens
+         * when its capacity already covers max(a.size(), b.size()). Operands may view `out`
+         * itself, `xor_into(out, b, out)` runs in place like `out ^= b`.
+         *
+         * @param a First operand
+         * @param b Second operand
+         * @param out Receives the result, keeps its memory resource
+         *
+         * @example
+         * ByteArray scratch = ByteArray::create_with_prealloc(1500);
+         * for (const auto& packet : packets) {
+         *     ByteArray::xor_into(packet, keystream, scratch); // no allocation per packet
+         *     send(scratch);
+         * }
+         */
+        static void xor_into(ByteView a, ByteView b, ByteArray& out);
+
+        // XORs a single byte into the last byte of a copy of input stored in out, reusing out's storage
+        static void xor_into(ByteView input, unsigned char byte, ByteArray& out);
 
-        // Comparison operator
-        bool operator==(const ByteArray& other) const;
+        /**
+         * @brief Writes the 1's complement of input into an existing ByteArray
+         *
+         * Same result as `out = ~input`, reusing `out`'s storage. `complement_into(out, out)`
+         * complements in place.
+         *
+         * @throws std::invalid_argument If input is empty
+         */
+        static void complement_into(ByteView input, ByteArray& out);
+
+        /**
+         * @brief Concatenates the given parts into an existing ByteArray
+         *
+         * Same result as `out = ByteArray::concat_and_create(...)`, reusing `out`'s storage.
+         * The result size is computed up front so the storage grows at most once.
+         *
+         * @param parts The byte sequences to concatenate, in order; they may view `out` itself
+         * @param out Receives the concatenation
+         */
+        static void concat_into(std::initializer_list<ByteView> parts, ByteArray& out);
+
+        /**
+         * @brief out[i] = a[i] ^ b[i] for every index, back to back without temporaries
+         *
+         * Equivalent to calling xor_into() per element, so every output reuses its storage and
+         * results of up to INLINE_CAPACITY bytes never allocate. For many records of one fixed
+         * length, ByteArrayBatch keeps them in a single block and is faster still.
+         *
+         * @throws std::invalid_argument If the three spans differ in length
+         */
+        static void xor_batch(std::span<const ByteView> a, std::span<const ByteView> b, std::span<ByteArray> out);
+
+        /**
+         * @brief out[i] = a[i] ^ key for every index
+         *
+         * @throws std::invalid_argument If a and out differ in length
+         */
+        static void xor_batch(std::span<const ByteView> a, ByteView key, std::span<ByteArray> out);
 
         // Logical operation end
 
@@ -238,10 +659,30 @@ namespace jlizard
          * @return Pointer to the internal buffer
          */
         [[nodiscard]] unsigned char* data() noexcept { return bytes_.data(); }
+        [[nodiscard]] const unsigned char* data() const noexcept { return bytes_.data(); }
         [[nodiscard]] size_t size() const noexcept { return bytes_.size(); }
         [[nodiscard]] bool empty() const noexcept {return bytes_.empty();}
-        [[nodiscard]] std::vector<unsigned char>::const_iterator begin() const noexcept { return bytes_.begin(); }
-        [[nodiscard]] std::vector<unsigned char>::const_iterator end() const noexcept { return bytes_.end(); }
+        /**
+         * @brief Mutable iterators, for loops that write the bytes in place
+         *
+         * Invalidated like data() by any operation that changes the size or storage.
+         */
+        [[nodiscard]] iterator begin() noexcept { return bytes_.begin(); }
+        [[nodiscard]] iterator end() noexcept { return bytes_.end(); }
+        [[nodiscard]] const_iterator begin() const noexcept { return bytes_.begin(); }
+        [[nodiscard]] const_iterator end() const noexcept { return bytes_.end(); }
+        [[nodiscard]] const_iterator cbegin() const noexcept { return bytes_.begin(); }
+        [[nodiscard]] const_iterator cend() const noexcept { return bytes_.end(); }
+        /**
+         * @brief Number of bytes that can be held without reallocating
+         *
+         * Never less than INLINE_CAPACITY, since small arrays are stored inside the object.
+         */
+        [[nodiscard]] size_t capacity() const noexcept { return bytes_.capacity(); }
+        /**
+         * @brief Returns the allocator whose memory resource backs this array's heap storage
+         */
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return allocator_type(bytes_.resource()); }
 
         /**
          * @brief Resizes the ByteArray to the specified size with configurable padding direction
@@ -254,9 +695,9 @@ namespace jlizard
          * @param purge_before_resize If true, securely wipes the original data before
          *        resizing to prevent data remnance. This is especially important when
          *        shrinking the array.
-         * @param output_warning If true, outputs a warning to std::cerr when shrinking
-         *        the array as this operation could potentially lead to data remnance
-         *        if not handled properly.
+         * @param output_warning Ignored, kept for source compatibility. Shrinking used to write
+         *        a warning to std::cerr; the truncated bytes are now erased in place, so
+         *        nothing is written.
          * @param zero_pad_dir Determines how the resize operation preserves bytes:
          *        - MSB_PAD: Preserves the most significant bytes (rightmost in big-endian):
          *          - When growing: adds zeros at the beginning
@@ -265,9 +706,11 @@ namespace jlizard
          *          - When growing: adds zeros at the end (default, consistent with std::vector)
          *          - When shrinking: keeps the leftmost/least significant bytes
          *
-         * @note When purge_before_resize is true, this method uses a secure copy-and-wipe
-         *       approach that creates a temporary ByteArray, securely wipes the original,
-         *       and then assigns the temporary to this object.
+         * @note The resize happens in place: shrinking moves the kept bytes to the front
+         *       (MSB_PAD only) and growing within the capacity only shifts (MSB_PAD) or
+         *       zero-fills (LSB_PAD). Growing past the capacity copies once into a new block.
+         *       With purge_before_resize the truncated tail, or the abandoned block when
+         *       growing past the capacity, is securely erased according to the wipe policy.
          *
          * @warning Shrinking a ByteArray may expose sensitive data if not properly wiped.
          *          Always consider using purge_before_resize=true when handling sensitive data.
@@ -302,11 +745,10 @@ namespace jlizard
          * @param zero_pad_dir Determines how the resize operation preserves bytes
          *        (see the full resize method documentation for details)
          * @param purge_before_resize If true (default), securely wipes original data
-         * @param output_warning If true (default), warns when shrinking the array
+         * @param output_warning Ignored, kept for source compatibility
          *
          * @note This overload uses secure defaults that prioritize data security:
          *       - purge_before_resize = true (securely wipes original data)
-         *       - output_warning = true (warns about potential data remnance when shrinking)
          *
          * @example
          * ByteArray data = {0x01, 0x02, 0x03};
@@ -322,10 +764,14 @@ namespace jlizard
         /**
          * @brief Clears all elements from the ByteArray.
          *
-         * Removes all elements from the underlying vector, leaving it with a size of 0.
-         * The capacity of the vector is not affected, and no reallocation happens.
-         * All references, pointers, and iterators to elements are invalidated.
+         * Sets the size to 0. The capacity is not affected, and no reallocation happens,
+         * so the array can be refilled without allocating. All references, pointers, and
+         * iterators to elements are invalidated.
          *
+         * @param bsecure_purge If true (default), the whole block, including unused capacity,
+         *        is securely erased according to the wipe policy first. Use secure_wipe() to
+         *        also release the memory.
+         * @throws security::unsafe::ErasureVerificationError If verification fails
          */
         void clear(const bool bsecure_purge = true);
 
@@ -333,6 +779,22 @@ namespace jlizard
         //get as 64bit unsigned long , if byte array is too large we throw an invalid argument exception
         // FIXME needs documentation
         [[nodiscard]] uint64_t as_64bit_uint() const;
+        /**
+         * @brief Converts the ByteArray content to an unsigned integer in the given byte order
+         *
+         * Arrays shorter than sizeof(T) are read as if the missing most significant bytes were
+         * zero, so `create_from_uint64(x).as_integral<uint64_t>() == x`.
+         *
+         * @tparam T Unsigned integer type (uint8_t ... uint64_t, unsigned __int128 where available)
+         * @tparam Order Byte order of the array, network order (MSB first) by default
+         * @throws std::invalid_argument If the array is larger than sizeof(T) bytes
+         *
+         * @example
+         * const auto port = ByteArray({0x01, 0xBB}).as_integral<uint16_t>();              // 443
+         * const auto tag = header.as_integral<uint32_t, EByteOrder::LSB_FIRST>();
+         */
+        template <CodecIntegral T, EByteOrder Order = EByteOrder::NETWORK>
+        [[nodiscard]] T as_integral() const { return ByteView(*this).as_integral<T, Order>(); }
         /**
          * @brief Converts the ByteArray content to a hexadecimal string representation
          *
@@ -347,6 +809,33 @@ namespace jlizard
          */
         [[nodiscard]] std::string as_hex_string() const;
 
+        /**
+         * @brief Appends the hexadecimal representation of the ByteArray to an existing string
+         *
+         * Same output as as_hex_string() but written into a caller-owned string, so that repeated
+         * encoding (e.g. for logging) reuses the string's capacity instead of allocating.
+         *
+         * @param out The string to append exactly 2 * size() lowercase hex characters to
+         *
+         * @example
+         * std::string line = "key=";
+         * ByteArray({0x01, 0xAB}).append_hex_to(line); // line is "key=01ab"
+         */
+        void append_hex_to(std::string& out) const;
+
+        /**
+         * @brief Writes the hexadecimal representation into the character range [first, last)
+         *
+         * Modelled after std::to_chars: no terminator is written and nothing is written at all
+         * if the range cannot hold 2 * size() characters.
+         *
+         * @param first Beginning of the destination range
+         * @param last End of the destination range
+         * @return {first + 2 * size(), std::errc{}} on success,
+         *         {last, std::errc::value_too_large} if the range is too small
+         */
+        std::to_chars_result to_hex_chars(char* first, char* last) const noexcept;
+
         /**
          * Creates a new ByteArray from a 64-bit unsigned integer
          * @param byte_array_long The 64-bit value to convert to a ByteArray
@@ -354,6 +843,28 @@ namespace jlizard
          */
         static ByteArray create_from_uint64(const uint64_t byte_array_long);
 
+        /**
+         * @brief Creates a sizeof(T) byte ByteArray from an unsigned integer
+         *
+         * Unlike create_from_uint64() the result always has the full width of T, leading zero
+         * bytes included, as needed for fixed-size protocol fields.
+         *
+         * @tparam T Unsigned integer type (uint8_t ... uint64_t, unsigned __int128 where available)
+         * @tparam Order Byte order of the result, network order (MSB first) by default
+         *
+         * @example
+         * ByteArray length = ByteArray::create_from_integral<uint16_t>(payload.size()); // {0x00, 0x2A}
+         * ByteArray le = ByteArray::create_from_integral<uint32_t, EByteOrder::LSB_FIRST>(1);  // {0x01, 0, 0, 0}
+         */
+        template <CodecIntegral T, EByteOrder Order = EByteOrder::NETWORK>
+        static ByteArray create_from_integral(const T value)
+        {
+            ByteArray result;
+            result.bytes_.resize_uninitialized(sizeof(T));
+            byte_order::store<Order>(value, result.bytes_.data());
+            return result;
+        }
+
         /**
          * Creates a new ByteArray by concatenating multiple ByteArrays
          * @param arrays An initializer list of ByteArray objects to concatenate
@@ -375,26 +886,43 @@ namespace jlizard
          */
         static ByteArray create_from_string(std::string_view sv);
         /**
-         * @brief Creates a new ByteArray filled with pseudo-random data
+         * @brief Creates a new ByteArray filled with cryptographically secure random data
          *
-         * Generates a ByteArray of the specified size containing pseudo-random bytes.
-         * This method uses a pseudo-random number generator to fill the array.
+         * The bytes are produced in bulk, either by one request to the operating system
+         * CSPRNG (getrandom, arc4random_buf or BCryptGenRandom) or by the calling thread's
+         * buffered ChaCha20 generator.
          *
          * @param num_bytes The number of random bytes to generate
+         * @param source Where the bytes come from, see ERandomSource
          * @return A new ByteArray filled with random data
          * @throws std::invalid_argument If num_bytes exceeds MAX_RANDOM_BYTES (1 MB)
+         * @throws std::runtime_error If the random source fails
          *
          * @see MAX_RANDOM_BYTES For the maximum allowed size
+         * @see fill_random To fill an existing array of any size without allocating
+         *
+         * @example
+         * // Create a 32-byte random key and a 12-byte nonce
+         * ByteArray key = ByteArray::create_from_prng(32);
+         * ByteArray nonce = ByteArray::create_from_prng(12, ERandomSource::THREAD_DRBG);
+         */
+        static ByteArray create_from_prng(size_t num_bytes, ERandomSource source = ERandomSource::SYSTEM);
+        /**
+         * @brief Overwrites every byte of an existing ByteArray with random data
          *
-         * @note The quality of randomness depends on the underlying PRNG implementation
-         * @warning This method is NOT cryptographically secure. Do not use for
-         *          security-sensitive applications or cryptographic purposes.
+         * The size and storage of `target` are kept, so a buffer can be refilled (e.g. once
+         * per message nonce) without allocating. The MAX_RANDOM_BYTES limit of
+         * create_from_prng does not apply.
+         *
+         * @param target The array to overwrite, its size selects the number of bytes
+         * @param source Where the bytes come from, see ERandomSource
+         * @throws std::runtime_error If the random source fails
          *
          * @example
-         * // Create a 32-byte random array
-         * ByteArray random_data = ByteArray::create_from_prng(32);
+         * ByteArray nonce(12, 0x00);
+         * ByteArray::fill_random(nonce, ERandomSource::THREAD_DRBG);
          */
-        static ByteArray create_from_prng(const size_t num_bytes);
+        static void fill_random(ByteArray& target, ERandomSource source = ERandomSource::SYSTEM);
         /**
          * @brief Creates a ByteArray with pre-allocated memory capacity
          *
@@ -411,6 +939,16 @@ namespace jlizard
          * @see ByteArray::reserve(size_t reserve_size)
          */
         static ByteArray create_with_prealloc(size_t reserve_size);
+        /**
+         * @brief Creates a ByteArray with pre-allocated memory capacity from a memory resource
+         *
+         * @param reserve_size Number of bytes to pre-allocate
+         * @param alloc The allocator (or memory resource pointer) to allocate from
+         * @return ByteArray A new, empty ByteArray instance with the requested capacity
+         *
+         * @see create_with_prealloc(size_t)
+         */
+        static ByteArray create_with_prealloc(size_t reserve_size, const allocator_type& alloc);
         /**
          * @brief Access the byte at the specified index with bounds checking
          *
@@ -435,11 +973,102 @@ namespace jlizard
         // Not noexcept because it can throw std::out_of_range
         [[nodiscard]] const unsigned char& at(const size_t index) const { return bytes_.at(index); }
 
+        /**
+         * @brief Access the byte at the specified index without bounds checking
+         *
+         * For hot loops that have already validated their indices. An out of range index is
+         * undefined behaviour; debug builds (and builds with BYTEAO_ENABLE_ASSERTS) abort
+         * with a diagnostic instead.
+         *
+         * @param index The zero-based index, must be less than size()
+         * @see operator[] and at() For bounds-checked access
+         */
+        [[nodiscard]] unsigned char& unchecked(const size_t index) noexcept
+        {
+            JLBA_ASSERT(index < bytes_.size(), "ByteArray::unchecked index out of range");
+            return bytes_[index];
+        }
+        [[nodiscard]] const unsigned char& unchecked(const size_t index) const noexcept
+        {
+            JLBA_ASSERT(index < bytes_.size(), "ByteArray::unchecked index out of range");
+            return bytes_[index];
+        }
+
 
     };
 
+    // XOR of two views (right-aligned), for operands that are not ByteArrays themselves
+    [[nodiscard]] inline expr::Xor<expr::Leaf, expr::Leaf> operator^(const ByteView lhs, const ByteView rhs) noexcept
+    {
+        return {expr::Leaf(lhs), expr::Leaf(rhs)};
+    }
+
+    // 1's complement of a view
+    [[nodiscard]] inline expr::Not<expr::Leaf> operator~(const ByteView view) noexcept
+    {
+        return expr::Not(expr::Leaf(view));
+    }
+
+    template <typename Expr>
+    void ByteArray::assign_expression_(const Expr& expression)
+    {
+        using Node = std::remove_cvref_t<Expr>;
+        // the single-operator forms go straight to the SIMD kernels
+        if constexpr (std::is_same_v<Node, expr::Xor<expr::Leaf, expr::Leaf>>) {
+            xor_into(expression.lhs().view(), expression.rhs().view(), *this);
+        } else if constexpr (std::is_same_v<Node, expr::Not<expr::Leaf>>) {
+            complement_into(expression.operand().view(), *this);
+        } else {
+            expression.validate();
+            const size_t result_size = expression.size();
+            if (expression.unsafe_alias(bytes_.data(), bytes_.capacity(), result_size)) {
+                // an operand would be overwritten before it is read, evaluate aside
+                ByteArray result(get_allocator());
+                result.assign_expression_(expression);
+                *this = std::move(result);
+                return;
+            }
+            bytes_.resize_uninitialized(result_size);
+            expr::evaluate(expression, bytes_.data());
+        }
+    }
+
+    namespace expr
+    {
+        // chains of lazy operators, found by ADL on the node types
+
+        template <Operand L, Operand R>
+            requires (is_expression_v<L> || is_expression_v<R>)
+        [[nodiscard]] auto operator^(const L& lhs, const R& rhs) noexcept
+        {
+            return Xor(as_node(lhs), as_node(rhs));
+        }
+
+        template <typename E>
+            requires is_expression_v<E>
+        [[nodiscard]] auto operator~(const E& operand) noexcept
+        {
+            return Not<E>(operand);
+        }
+
+        // XOR of an expression with a single byte, evaluated eagerly like ByteArray::operator^(unsigned char)
+        template <typename E>
+            requires is_expression_v<E>
+        [[nodiscard]] ByteArray operator^(const E& expression, const unsigned char byte)
+        {
+            ByteArray result(expression);
+            result ^= byte;
+            return result;
+        }
+    }
+
 }
 
 
 
+// with BYTEAO_INLINE_HOT_PATHS the small-array paths are defined here instead of in the library
+#if defined(JLBA_INLINE_HOT_PATHS)
+#include "jlizard/byte_array_inline.h"
+#endif
+
 #endif //BYTE_ARRAY_H
@@ -0,0 +1,160 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_ARRAY_BATCH_H
+#define BYTE_ARRAY_BATCH_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+
+#include "jlizard/byte_storage.h"
+#include "jlizard/byte_view.h"
+#include "jlizard/debug_assert.h"
+
+namespace jlizard
+{
+    /**
+     * @class ByteArrayBatch
+     * @brief Contiguous structure-of-arrays container for many records of the same length
+     *
+     * Per-record masks built with `operator^` cost one temporary and usually one allocation
+     * per record. A ByteArrayBatch keeps every record back to back in a single block instead,
+     * so the batch operations below run one kernel pass over the whole block (split across
+     * cores when it is large, see parallel::Config) and a batch of any size needs exactly
+     * one allocation.
+     *
+     * Records are addressed by index: operator[] and at() return a ByteView, record() a
+     * writable span. The views are invalidated when the batch grows or is destroyed.
+     *
+     * @example
+     * ByteArrayBatch records(16);
+     * for (const auto& r : incoming) records.push_back(r);
+     *
+     * ByteArrayBatch masked;
+     * ByteArrayBatch::xor_into(records, mask, masked);   // every record ^ mask, one pass
+     * send(masked[0]);
+     */
+    class ByteArrayBatch
+    {
+    public:
+        using allocator_type = std::pmr::polymorphic_allocator<unsigned char>;
+
+        // an empty batch with record size 1, the batch operations adopt the operands' record size
+        ByteArrayBatch() noexcept = default;
+
+        /**
+         * @brief Creates count zero filled records of record_size bytes
+         * @throws std::invalid_argument If record_size is zero
+         * @throws std::length_error If count * record_size does not fit size_t
+         */
+        explicit ByteArrayBatch(size_t record_size, size_t count = 0, const allocator_type& alloc = {});
+
+        [[nodiscard]] size_t record_size() const noexcept { return record_size_; }
+        // number of records
+        [[nodiscard]] size_t size() const noexcept { return bytes_.size() / record_size_; }
+        [[nodiscard]] bool empty() const noexcept { return bytes_.empty(); }
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return allocator_type(bytes_.resource()); }
+
+        // all records back to back, size() * record_size() bytes
+        [[nodiscard]] ByteView view() const noexcept { return {bytes_.data(), bytes_.size()}; }
+        [[nodiscard]] unsigned char* data() noexcept { return bytes_.data(); }
+        [[nodiscard]] const unsigned char* data() const noexcept { return bytes_.data(); }
+
+        // unchecked record access, asserted in debug builds
+        ByteView operator[](const size_t index) const noexcept
+        {
+            JLBA_ASSERT(index < size(), "ByteArrayBatch index out of range");
+            return {bytes_.data() + index * record_size_, record_size_};
+        }
+        [[nodiscard]] std::span<unsigned char> record(const size_t index) noexcept
+        {
+            JLBA_ASSERT(index < size(), "ByteArrayBatch index out of range");
+            return {bytes_.data() + index * record_size_, record_size_};
+        }
+
+        /**
+         * @brief Bounds checked record access
+         * @throws std::out_of_range If index >= size()
+         */
+        [[nodiscard]] ByteView at(size_t index) const;
+
+        // capacity for count records without reallocating, throws std::length_error if the byte size overflows
+        void reserve(size_t count);
+        // grows with zero filled records or drops trailing ones, throws std::length_error like reserve()
+        void resize(size_t count);
+        void clear() noexcept { bytes_.clear(); }
+
+        /**
+         * @brief Appends a copy of record
+         * @throws std::invalid_argument If record.size() != record_size()
+         */
+        void push_back(ByteView record);
+
+        /**
+         * @brief out[i] = a[i] ^ b[i] for every record
+         *
+         * `out` takes the record size and count of the operands and reuses its storage,
+         * it may be one of the operands.
+         *
+         * @throws std::invalid_argument If the record sizes or counts differ
+         */
+        static void xor_into(const ByteArrayBatch& a, const ByteArrayBatch& b, ByteArrayBatch& out);
+
+        /**
+         * @brief out[i] = a[i] ^ key for every record, key is as long as a record
+         *
+         * The key is repeated into a small pattern once, the records are then XORed against
+         * it a few KiB at a time.
+         *
+         * @throws std::invalid_argument If key.size() != a.record_size()
+         */
+        static void xor_into(const ByteArrayBatch& a, ByteView key, ByteArrayBatch& out);
+
+        // out[i] = ~a[i] for every record, out may be a
+        static void complement_into(const ByteArrayBatch& a, ByteArrayBatch& out);
+
+        // in place versions of xor_into
+        ByteArrayBatch& operator^=(const ByteArrayBatch& other);
+        ByteArrayBatch& operator^=(ByteView key);
+
+        // equal record sizes and contents
+        bool operator==(const ByteArrayBatch& other) const noexcept;
+
+        /**
+         * @brief Securely erases the whole block and releases it, the record size is kept
+         *
+         * @return true once the erasure has been verified
+         * @throws security::unsafe::ErasureVerificationError If verification fails
+         */
+        bool secure_wipe();
+
+    private:
+        ByteStorage bytes_;
+        size_t record_size_ = 1;
+    };
+}
+
+#endif //BYTE_ARRAY_BATCH_H
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_ARRAY_INLINE_H
+#define BYTE_ARRAY_INLINE_H
+
+#include <utility>
+
+#include "jlizard/byte_array.h"
+#include "jlizard/inline_hot_paths.h"
+
+// Hot path definitions of ByteArray, inline in the headers or compiled into the library, see inline_hot_paths.h
+
+namespace jlizard
+{
+    JLBA_HOT_INLINE ByteArray ByteArray::operator^(const unsigned char byte) const&
+    {
+        ByteArray result(static_cast<ByteView>(*this));
+        result ^= byte;
+        return result;
+    }
+
+    JLBA_HOT_INLINE ByteArray ByteArray::operator^(const unsigned char byte) &&
+    {
+        *this ^= byte;
+        return std::move(*this);
+    }
+
+    JLBA_HOT_INLINE ByteArray& ByteArray::operator^=(const ByteView other)
+    {
+        // short operands that fit XOR right-aligned in place, unless they view another part of
+        // this array; growth, partial overlap and large inputs take the kernel path
+        if (other.size() <= bytes_.size() && other.size() <= detail::inline_kernel_ceiling) {
+            unsigned char* tail = bytes_.data() + (bytes_.size() - other.size());
+            if (other.data() == tail || !detail::ranges_overlap(other.data(), other.size(), bytes_.data(), bytes_.size())) {
+                detail::xor_small(tail, other.data(), tail, other.size());
+                return *this;
+            }
+        }
+        return xor_assign_(other);
+    }
+
+    JLBA_HOT_INLINE ByteArray& ByteArray::operator^=(const unsigned char byte)
+    {
+        if (bytes_.empty()) {
+            bytes_.push_back(byte);
+        } else {
+            bytes_.back() ^= byte;
+        }
+        return *this;
+    }
+
+    JLBA_HOT_INLINE uint64_t ByteArray::as_64bit_uint() const
+    {
+        return ByteView(*this).as_64bit_uint();
+    }
+}
+
+#endif //BYTE_ARRAY_INLINE_H
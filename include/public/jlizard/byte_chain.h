@@ -0,0 +1,170 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_CHAIN_H
+#define BYTE_CHAIN_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "jlizard/byte_array.h"
+#include "jlizard/byte_view.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define JLBA_HAS_WRITEV 1
+#endif
+
+namespace jlizard
+{
+    class SharedByteArray;
+
+    /**
+     * @class ByteChain
+     * @brief Scatter-gather sequence of byte segments that is concatenated only when needed
+     *
+     * Building a frame from header + payload + MAC with concat() copies every part and can
+     * reallocate on each step. A ByteChain instead records the parts as segments and
+     * defers the copy: flatten() assembles them with a single exact-size allocation,
+     * write_to() hands them to writev() without assembling them at all, and the bitwise
+     * operations run segment by segment straight into their output.
+     *
+     * Segments are either borrowed (a ByteView, the caller keeps the bytes alive and
+     * unchanged while the chain uses them) or shared (a ByteArray owned through a
+     * shared_ptr, kept alive by every chain referring to it). Copying a chain copies the
+     * segment list only, never the bytes.
+     *
+     * Indexing and the bitwise operations follow the semantics of the flattened array,
+     * including the right alignment of XOR with operands of different length.
+     *
+     * @example
+     * ByteChain frame;
+     * frame.append(header).append(payload_view).append(ByteArray(mac));   // mac is moved into the chain
+     * frame.write_to(socket_fd);                                          // one writev, no copy
+     * ByteArray wire = frame.flatten();                                   // or one allocation
+     */
+    class ByteChain
+    {
+    public:
+        ByteChain() = default;
+
+        /**
+         * @brief Appends a borrowed segment, the bytes are not copied
+         * @warning The viewed bytes must outlive every use of the chain
+         */
+        ByteChain& append(ByteView bytes);
+        /**
+         * @brief Appends a segment owned by the chain, moved in without copying the bytes
+         */
+        ByteChain& append(ByteArray&& bytes);
+        /**
+         * @brief Appends a segment shared with other owners, it is kept alive by the chain
+         */
+        ByteChain& append(std::shared_ptr<const ByteArray> bytes);
+        /**
+         * @brief Appends the bytes of a SharedByteArray, the chain becomes one more owner of its block
+         */
+        ByteChain& append(const SharedByteArray& bytes);
+        /**
+         * @brief Appends all segments of another chain, shared segments stay shared
+         */
+        ByteChain& append(const ByteChain& other);
+
+        [[nodiscard]] size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] size_t segment_count() const noexcept { return segments_.size(); }
+        // view of the segment at index, unchecked like ByteView::operator[]
+        [[nodiscard]] ByteView segment(size_t index) const noexcept;
+
+        /**
+         * @brief Byte at index of the flattened sequence, linear in the number of segments
+         * @throws std::out_of_range If index >= size()
+         */
+        [[nodiscard]] unsigned char at(size_t index) const;
+
+        // Removes all segments, releasing the chain's references to shared ones
+        void clear() noexcept;
+
+        /**
+         * @brief Concatenates the segments into a new ByteArray with one exact-size allocation
+         */
+        [[nodiscard]] ByteArray flatten() const;
+        /**
+         * @brief Concatenates the segments into out, reusing its capacity
+         *
+         * Segments may view out itself.
+         */
+        void flatten_into(ByteArray& out) const;
+
+        /**
+         * @brief XORs the flattened sequence with other (right-aligned) into out
+         *
+         * Same result as `out = flatten() ^ other`, computed segment by segment in a single
+         * pass without the intermediate copy. Operands may view out itself.
+         */
+        void xor_into(ByteView other, ByteArray& out) const;
+        /**
+         * @brief Writes the complement of the flattened sequence into out, segment by segment
+         *
+         * Same result as `out = ~flatten()`. Operands may view out itself.
+         * @throws std::invalid_argument If the chain is empty, like ByteArray's operator~
+         */
+        void complement_into(ByteArray& out) const;
+
+        // true if the flattened sequence equals view, compared segment by segment
+        [[nodiscard]] bool equals(ByteView view) const noexcept;
+        friend bool operator==(const ByteChain& chain, const ByteView view) noexcept { return chain.equals(view); }
+
+#if defined(JLBA_HAS_WRITEV)
+        /**
+         * @brief Writes all segments to a file descriptor with writev(), without flattening
+         *
+         * Partial writes and interrupted calls are resumed until everything has been written,
+         * chains with more segments than IOV_MAX are written in several batches.
+         *
+         * @param fd A blocking file descriptor
+         * @return The number of bytes written, always size()
+         * @throws std::system_error If writev fails
+         */
+        size_t write_to(int fd) const;
+#endif
+
+    private:
+        struct Segment
+        {
+            ByteView view;
+            // keeps shared segments alive, null for borrowed ones
+            std::shared_ptr<const ByteArray> owner;
+        };
+
+        // true if any segment or extra points into out's block
+        [[nodiscard]] bool aliases_(const ByteArray& out, ByteView extra) const noexcept;
+
+        std::vector<Segment> segments_;
+        size_t size_ = 0;
+    };
+}
+
+#endif //BYTE_CHAIN_H
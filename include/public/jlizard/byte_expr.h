@@ -0,0 +1,297 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_EXPR_H
+#define BYTE_EXPR_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "jlizard/byte_view.h"
+
+/**
+ * @file byte_expr.h
+ * @brief Lazy expression nodes for chained bitwise operations
+ *
+ * `a ^ b`, `~a` and any combination of them, e.g. `a ^ b ^ ~c`, build a small tree of
+ * nodes instead of a ByteArray per step. The tree is evaluated in a single pass over the
+ * output when it is assigned to (or used to construct) a ByteArray, eight bytes at a time,
+ * without temporaries.
+ *
+ * The semantics are exactly those of the eager operators: every node is right-aligned and
+ * zero padded on the left inside its parent, an XOR is as long as its longer operand and
+ * the complement of an empty operand throws std::invalid_argument.
+ *
+ * @warning Nodes only refer to their operands. Evaluate an expression within the same full
+ * expression or keep its operands alive, `auto lazy = ByteArray(...) ^ key;` dangles.
+ */
+namespace jlizard::expr
+{
+    namespace detail
+    {
+        // inactive leaves (the zero padding in front of a shorter operand) read from here
+        inline constexpr size_t kZeroBlockSize = 512;
+        alignas(64) inline constexpr unsigned char kZeroBlock[kZeroBlockSize] = {};
+
+        inline std::uint64_t load_word(const unsigned char* p) noexcept
+        {
+            std::uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            return word;
+        }
+
+        inline bool overlaps(const ByteView view, const unsigned char* block, const size_t capacity) noexcept
+        {
+            if (view.empty()) return false;
+            const auto view_begin = reinterpret_cast<std::uintptr_t>(view.data());
+            const auto block_begin = reinterpret_cast<std::uintptr_t>(block);
+            return view_begin < block_begin + capacity && block_begin < view_begin + view.size();
+        }
+    }
+
+    /**
+     * @brief Expression leaf referring to an operand's bytes
+     *
+     * During evaluation the leaf is bound to one chunk of the output at a time and then
+     * reads either its own bytes or, inside its left zero padding, the zero block.
+     */
+    class Leaf
+    {
+    public:
+        static constexpr size_t node_count = 1;
+
+        explicit Leaf(const ByteView view) noexcept : view_(view) {}
+
+        [[nodiscard]] ByteView view() const noexcept { return view_; }
+        [[nodiscard]] size_t size() const noexcept { return view_.size(); }
+
+        void validate() const noexcept {}
+
+        void collect_starts(const size_t root_size, size_t* starts, size_t& count) const noexcept
+        {
+            starts[count++] = root_size - size();
+        }
+
+        // true if evaluating into [block, block + capacity) with a result of root_size bytes
+        // would overwrite or reallocate these bytes before they are read
+        [[nodiscard]] bool unsafe_alias(const unsigned char* block, const size_t capacity, const size_t root_size) const noexcept
+        {
+            if (!detail::overlaps(view_, block, capacity)) return false;
+            return view_.data() != block || view_.size() != root_size || root_size > capacity;
+        }
+
+        void bind(const size_t begin, const size_t root_size) noexcept
+        {
+            const size_t start = root_size - size();
+            cursor_ = begin >= start ? view_.data() + (begin - start) : detail::kZeroBlock;
+        }
+
+        [[nodiscard]] unsigned char at(const size_t k) const noexcept { return cursor_[k]; }
+        [[nodiscard]] std::uint64_t word_at(const size_t k) const noexcept { return detail::load_word(cursor_ + k); }
+
+    private:
+        ByteView view_;
+        const unsigned char* cursor_ = nullptr;
+    };
+
+    /**
+     * @brief Right-aligned XOR of two nodes
+     */
+    template <typename L, typename R>
+    class Xor
+    {
+    public:
+        static constexpr size_t node_count = 1 + L::node_count + R::node_count;
+
+        Xor(const L& lhs, const R& rhs) noexcept : lhs_(lhs), rhs_(rhs) {}
+
+        [[nodiscard]] const L& lhs() const noexcept { return lhs_; }
+        [[nodiscard]] const R& rhs() const noexcept { return rhs_; }
+        [[nodiscard]] size_t size() const noexcept { return std::max(lhs_.size(), rhs_.size()); }
+
+        void validate() const
+        {
+            lhs_.validate();
+            rhs_.validate();
+        }
+
+        void collect_starts(const size_t root_size, size_t* starts, size_t& count) const noexcept
+        {
+            starts[count++] = root_size - size();
+            lhs_.collect_starts(root_size, starts, count);
+            rhs_.collect_starts(root_size, starts, count);
+        }
+
+        [[nodiscard]] bool unsafe_alias(const unsigned char* block, const size_t capacity, const size_t root_size) const noexcept
+        {
+            return lhs_.unsafe_alias(block, capacity, root_size) || rhs_.unsafe_alias(block, capacity, root_size);
+        }
+
+        // inside the padding of this node both operands are inactive as well, so no mask is needed
+        void bind(const size_t begin, const size_t root_size) noexcept
+        {
+            lhs_.bind(begin, root_size);
+            rhs_.bind(begin, root_size);
+        }
+
+        [[nodiscard]] unsigned char at(const size_t k) const noexcept
+        {
+            return static_cast<unsigned char>(lhs_.at(k) ^ rhs_.at(k));
+        }
+        [[nodiscard]] std::uint64_t word_at(const size_t k) const noexcept { return lhs_.word_at(k) ^ rhs_.word_at(k); }
+
+    private:
+        L lhs_;
+        R rhs_;
+    };
+
+    /**
+     * @brief 1's complement of a node
+     */
+    template <typename E>
+    class Not
+    {
+    public:
+        static constexpr size_t node_count = 1 + E::node_count;
+
+        explicit Not(const E& operand) noexcept : operand_(operand) {}
+
+        [[nodiscard]] const E& operand() const noexcept { return operand_; }
+        [[nodiscard]] size_t size() const noexcept { return operand_.size(); }
+
+        void validate() const
+        {
+            if (operand_.size() == 0) {
+                throw std::invalid_argument("Cannot process an empty byte array");
+            }
+            operand_.validate();
+        }
+
+        void collect_starts(const size_t root_size, size_t* starts, size_t& count) const noexcept
+        {
+            starts[count++] = root_size - size();
+            operand_.collect_starts(root_size, starts, count);
+        }
+
+        [[nodiscard]] bool unsafe_alias(const unsigned char* block, const size_t capacity, const size_t root_size) const noexcept
+        {
+            return operand_.unsafe_alias(block, capacity, root_size);
+        }
+
+        // the padding in front of a complement is zero, not ~0
+        void bind(const size_t begin, const size_t root_size) noexcept
+        {
+            operand_.bind(begin, root_size);
+            mask_ = begin >= root_size - size() ? ~std::uint64_t{0} : 0;
+        }
+
+        [[nodiscard]] unsigned char at(const size_t k) const noexcept
+        {
+            return static_cast<unsigned char>(~operand_.at(k) & mask_);
+        }
+        [[nodiscard]] std::uint64_t word_at(const size_t k) const noexcept { return ~operand_.word_at(k) & mask_; }
+
+    private:
+        E operand_;
+        std::uint64_t mask_ = 0;
+    };
+
+    template <typename T>
+    struct is_expression : std::false_type {};
+    template <typename L, typename R>
+    struct is_expression<Xor<L, R>> : std::true_type {};
+    template <typename E>
+    struct is_expression<Not<E>> : std::true_type {};
+
+    // true for the lazy Xor / Not nodes (not for plain leaves)
+    template <typename T>
+    inline constexpr bool is_expression_v = is_expression<std::remove_cvref_t<T>>::value;
+
+    // anything that can take part in an expression: a node or something convertible to ByteView
+    template <typename T>
+    concept Operand = is_expression_v<T> || std::is_convertible_v<const T&, ByteView>;
+
+    template <typename T>
+    auto as_node(const T& operand) noexcept
+    {
+        if constexpr (is_expression_v<T>) {
+            return operand;
+        } else {
+            return Leaf(ByteView(operand));
+        }
+    }
+
+    /**
+     * @brief Evaluates an expression into out, which must hold expr.size() bytes
+     *
+     * The output is split at every node's start (the end of its left zero padding), so in
+     * each chunk every node is either fully active or fully padding. Each chunk is then a
+     * single branch-free loop over eight byte words.
+     */
+    template <typename Expr>
+    void evaluate(Expr expr, unsigned char* out) noexcept
+    {
+        const size_t root_size = expr.size();
+
+        std::array<size_t, Expr::node_count + 1> bounds{};
+        size_t count = 0;
+        expr.collect_starts(root_size, bounds.data(), count);
+        bounds[count++] = root_size;
+        std::sort(bounds.begin(), bounds.begin() + count);
+
+        // from the last start on every leaf reads its own bytes, before it chunks must fit the zero block
+        const size_t all_active_from = bounds[count - 2];
+
+        size_t begin = 0;
+        for (size_t b = 0; b < count && begin < root_size; ++b) {
+            const size_t segment_end = bounds[b];
+            while (begin < segment_end) {
+                const size_t end = begin >= all_active_from
+                                       ? segment_end
+                                       : std::min(segment_end, begin + detail::kZeroBlockSize);
+                expr.bind(begin, root_size);
+
+                const size_t length = end - begin;
+                unsigned char* chunk = out + begin;
+                size_t k = 0;
+                for (; k + sizeof(std::uint64_t) <= length; k += sizeof(std::uint64_t)) {
+                    const std::uint64_t word = expr.word_at(k);
+                    std::memcpy(chunk + k, &word, sizeof(word));
+                }
+                for (; k < length; ++k) {
+                    chunk[k] = expr.at(k);
+                }
+                begin = end;
+            }
+        }
+    }
+}
+
+#endif //BYTE_EXPR_H
@@ -0,0 +1,155 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_ORDER_H
+#define BYTE_ORDER_H
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace jlizard
+{
+    /**
+     * @brief Byte order used when converting integers to and from bytes
+     */
+    enum class EByteOrder : std::uint8_t
+    {
+        // Most significant byte first (big-endian)
+        MSB_FIRST = 1,
+        // Least significant byte first (little-endian)
+        LSB_FIRST = 2,
+        // Network byte order, the library's default
+        NETWORK = MSB_FIRST
+    };
+
+    /**
+     * @brief Unsigned integer types supported by the integral conversions (u8 to u64, plus u128 where available)
+     */
+    template <typename T>
+    concept CodecIntegral = (std::unsigned_integral<T> && !std::same_as<T, bool>)
+#if defined(__SIZEOF_INT128__)
+                            || std::same_as<T, unsigned __int128>
+#endif
+        ;
+
+    /**
+     * @brief Word-at-a-time integer <-> byte conversions
+     *
+     * Everything goes through a single byte swap and a std::bit_cast (or memcpy for runtime
+     * buffers) instead of per-byte shifts. The std::array overloads are constexpr.
+     */
+    namespace byte_order
+    {
+        /**
+         * @brief Reverses the bytes of an unsigned integer
+         *
+         * Equivalent to C++23 std::byteswap, which is not available in C++20.
+         */
+        template <CodecIntegral T>
+        [[nodiscard]] constexpr T byteswap(const T value) noexcept
+        {
+            if constexpr (sizeof(T) == 1) {
+                return value;
+#if defined(__GNUC__)
+            } else if constexpr (sizeof(T) == 2) {
+                return __builtin_bswap16(value);
+            } else if constexpr (sizeof(T) == 4) {
+                return __builtin_bswap32(value);
+            } else if constexpr (sizeof(T) == 8) {
+                return __builtin_bswap64(value);
+            } else if constexpr (sizeof(T) == 16) {
+                const auto low = static_cast<std::uint64_t>(value);
+                const auto high = static_cast<std::uint64_t>(value >> 64);
+                return (static_cast<T>(__builtin_bswap64(low)) << 64) | __builtin_bswap64(high);
+#endif
+            } else {
+                T result = 0;
+                for (size_t i = 0; i < sizeof(T); ++i) {
+                    result = static_cast<T>((result << 8) | ((value >> (8 * i)) & 0xFF));
+                }
+                return result;
+            }
+        }
+
+        // converts between native and the requested order (the conversion is its own inverse)
+        template <EByteOrder Order, CodecIntegral T>
+        [[nodiscard]] constexpr T to_order(const T value) noexcept
+        {
+            static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+                          "mixed-endian platforms are not supported");
+            constexpr bool native_msb_first = std::endian::native == std::endian::big;
+            if constexpr ((Order == EByteOrder::MSB_FIRST) == native_msb_first) {
+                return value;
+            } else {
+                return byteswap(value);
+            }
+        }
+
+        // the sizeof(T) bytes of value in the requested order
+        template <EByteOrder Order = EByteOrder::NETWORK, CodecIntegral T>
+        [[nodiscard]] constexpr std::array<unsigned char, sizeof(T)> to_bytes(const T value) noexcept
+        {
+            return std::bit_cast<std::array<unsigned char, sizeof(T)>>(to_order<Order>(value));
+        }
+
+        // the integer stored in bytes in the requested order
+        template <CodecIntegral T, EByteOrder Order = EByteOrder::NETWORK>
+        [[nodiscard]] constexpr T from_bytes(const std::array<unsigned char, sizeof(T)>& bytes) noexcept
+        {
+            return to_order<Order>(std::bit_cast<T>(bytes));
+        }
+
+        // writes the sizeof(T) bytes of value to out
+        template <EByteOrder Order = EByteOrder::NETWORK, CodecIntegral T>
+        void store(const T value, unsigned char* out) noexcept
+        {
+            const T ordered = to_order<Order>(value);
+            std::memcpy(out, &ordered, sizeof(T));
+        }
+
+        /**
+         * @brief Reads an integer from size <= sizeof(T) bytes
+         *
+         * Missing bytes are the most significant ones and read as zero: with MSB_FIRST the
+         * input is right-aligned (like ByteArray's XOR), with LSB_FIRST it is left-aligned.
+         */
+        template <CodecIntegral T, EByteOrder Order = EByteOrder::NETWORK>
+        [[nodiscard]] T load(const unsigned char* in, const size_t size) noexcept
+        {
+            std::array<unsigned char, sizeof(T)> bytes{};
+            if (size > 0) {
+                const size_t offset = Order == EByteOrder::MSB_FIRST ? sizeof(T) - size : 0;
+                std::memcpy(bytes.data() + offset, in, size);
+            }
+            return from_bytes<T, Order>(bytes);
+        }
+    }
+}
+
+#endif //BYTE_ORDER_H
@@ -0,0 +1,175 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_READER_H
+#define BYTE_READER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "jlizard/byte_order.h"
+#include "jlizard/byte_view.h"
+
+namespace jlizard
+{
+    /**
+     * @class ByteReader
+     * @brief Zero-copy parsing cursor over a ByteView
+     *
+     * Every read checks the remaining size once for the whole field and then decodes it
+     * directly from the viewed bytes; slices are returned as sub-views of the input, so a
+     * decoder built on it never allocates. The viewed bytes must outlive the reader and
+     * every view it returned.
+     *
+     * Reads past the end throw std::out_of_range and leave the position unchanged.
+     *
+     * @example
+     * ByteReader reader(packet);
+     * const auto type = reader.read_u8();
+     * const auto version = reader.read_integral<uint16_t>();
+     * const ByteView body = reader.read_prefixed<uint16_t>();        // 2 byte length, then the bytes
+     * const auto crc = reader.read_integral<uint32_t, EByteOrder::LSB_FIRST>();
+     */
+    class ByteReader
+    {
+    public:
+        constexpr ByteReader() noexcept = default;
+        explicit constexpr ByteReader(const ByteView input) noexcept : input_(input) {}
+
+        // reads one byte
+        [[nodiscard]] unsigned char read_u8()
+        {
+            require_(1);
+            return input_.data()[position_++];
+        }
+
+        // reads a sizeof(T) byte integer, network order (MSB first) by default
+        template <CodecIntegral T, EByteOrder Order = EByteOrder::NETWORK>
+        [[nodiscard]] T read_integral()
+        {
+            require_(sizeof(T));
+            const T value = byte_order::load<T, Order>(input_.data() + position_, sizeof(T));
+            position_ += sizeof(T);
+            return value;
+        }
+
+        /**
+         * @brief Reads a width byte integer (width <= sizeof(T)), e.g. a 24 bit length field
+         *
+         * The missing high bytes read as zero, as in ByteView::as_integral().
+         *
+         * @throws std::invalid_argument If width > sizeof(T)
+         */
+        template <CodecIntegral T = uint64_t, EByteOrder Order = EByteOrder::NETWORK>
+        [[nodiscard]] T read_integral(const size_t width)
+        {
+            if (width > sizeof(T)) throw_width_(width, sizeof(T));
+            require_(width);
+            const T value = byte_order::load<T, Order>(input_.data() + position_, width);
+            position_ += width;
+            return value;
+        }
+
+        // the next count bytes as a view into the input
+        [[nodiscard]] ByteView read_bytes(const size_t count)
+        {
+            require_(count);
+            const ByteView result(input_.data() + position_, count);
+            position_ += count;
+            return result;
+        }
+
+        /**
+         * @brief Reads a length prefixed slice: a LengthT length field followed by that many bytes
+         *
+         * Nothing is consumed unless both the prefix and the bytes are available.
+         */
+        template <CodecIntegral LengthT, EByteOrder Order = EByteOrder::NETWORK>
+        [[nodiscard]] ByteView read_prefixed()
+        {
+            require_(sizeof(LengthT));
+            const LengthT length = byte_order::load<LengthT, Order>(input_.data() + position_, sizeof(LengthT));
+            if (length > remaining() - sizeof(LengthT)) {
+                // reported apart from the prefix size, their sum may not fit size_t
+                constexpr auto max_reported = std::numeric_limits<std::uint64_t>::max();
+                const bool saturated = length > max_reported;
+                throw_prefixed_underrun_(sizeof(LengthT), saturated ? max_reported : static_cast<std::uint64_t>(length),
+                                         saturated);
+            }
+            const ByteView result(input_.data() + position_ + sizeof(LengthT), static_cast<size_t>(length));
+            position_ += sizeof(LengthT) + static_cast<size_t>(length);
+            return result;
+        }
+
+        // a reader over the next count bytes, for nested structures
+        [[nodiscard]] ByteReader read_reader(const size_t count) { return ByteReader(read_bytes(count)); }
+
+        // reads a sizeof(T) byte integer without consuming it
+        template <CodecIntegral T, EByteOrder Order = EByteOrder::NETWORK>
+        [[nodiscard]] T peek_integral() const
+        {
+            require_(sizeof(T));
+            return byte_order::load<T, Order>(input_.data() + position_, sizeof(T));
+        }
+
+        void skip(const size_t count)
+        {
+            require_(count);
+            position_ += count;
+        }
+
+        // moves to an absolute offset, position <= input().size()
+        void seek(const size_t position)
+        {
+            if (position > input_.size()) throw_seek_(position);
+            position_ = position;
+        }
+
+        [[nodiscard]] constexpr size_t position() const noexcept { return position_; }
+        [[nodiscard]] constexpr size_t remaining() const noexcept { return input_.size() - position_; }
+        [[nodiscard]] constexpr bool empty() const noexcept { return position_ == input_.size(); }
+        // the unread bytes
+        [[nodiscard]] constexpr ByteView rest() const noexcept { return {input_.data() + position_, remaining()}; }
+        [[nodiscard]] constexpr ByteView input() const noexcept { return input_; }
+
+    private:
+        void require_(const size_t count) const
+        {
+            if (count > remaining()) throw_underrun_(count);
+        }
+        // out of line so the inlined reads stay small
+        [[noreturn]] void throw_underrun_(size_t count) const;
+        // saturated: the length field held more than max uint64_t
+        [[noreturn]] void throw_prefixed_underrun_(size_t prefix_size, std::uint64_t length, bool saturated) const;
+        [[noreturn]] static void throw_width_(size_t width, size_t max_width);
+        [[noreturn]] void throw_seek_(size_t position) const;
+
+        ByteView input_;
+        size_t position_ = 0;
+    };
+}
+
+#endif //BYTE_READER_H
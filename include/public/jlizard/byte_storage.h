@@ -0,0 +1,170 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_STORAGE_H
+#define BYTE_STORAGE_H
+
+/**
+ * @brief Number of bytes a ByteArray can hold without touching the heap
+ *
+ * Can be overridden at configure time (CMake option BYTEAO_INLINE_CAPACITY), it must be
+ * identical for the library and every translation unit using it.
+ */
+#ifndef JLBA_INLINE_CAPACITY
+#define JLBA_INLINE_CAPACITY 32
+#endif
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "jlizard/debug_assert.h"
+#include <stdexcept>
+
+namespace jlizard
+{
+    /**
+     * @class ByteStorage
+     * @brief Contiguous byte buffer with inline small-buffer storage
+     *
+     * Up to `inline_capacity` bytes are stored inside the object itself; larger contents
+     * move to a heap block that grows geometrically like std::vector. Shrinking never
+     * moves data back inline, only release() does.
+     *
+     * Heap blocks come from a std::pmr::memory_resource (the default resource unless one is
+     * given), so arenas and pools can back the storage. Resource propagation follows the
+     * std::pmr containers: copies use the default resource, moves keep the source's resource
+     * and assignment keeps the target's resource, copying when the two resources differ.
+     *
+     * When the resource is a SecureMemoryResource the storage is secure: heap blocks are
+     * erased by the resource on deallocation, and the inline buffer is erased here whenever
+     * its contents move to the heap, are moved out or are released.
+     *
+     * This is the storage backend of ByteArray. It is deliberately minimal: it neither
+     * wipes nor verifies memory, callers that need that (e.g. ByteArray::secure_wipe())
+     * erase [data(), data() + capacity()) themselves before calling release().
+     */
+    class ByteStorage
+    {
+    public:
+        static constexpr size_t inline_capacity = JLBA_INLINE_CAPACITY;
+        static_assert(inline_capacity > 0, "JLBA_INLINE_CAPACITY must be at least 1");
+
+        ByteStorage() noexcept : data_(inline_) {}
+        explicit ByteStorage(std::pmr::memory_resource* resource) noexcept;
+        ByteStorage(size_t count, unsigned char value, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        ByteStorage(const unsigned char* first, size_t count, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        ByteStorage(const ByteStorage& other);
+        ByteStorage(const ByteStorage& other, std::pmr::memory_resource* resource);
+        ByteStorage(ByteStorage&& other) noexcept;
+        ByteStorage& operator=(const ByteStorage& other);
+        // not noexcept: the bytes are copied when the two resources differ
+        ByteStorage& operator=(ByteStorage&& other);
+        ~ByteStorage();
+
+        [[nodiscard]] unsigned char* data() noexcept { return data_; }
+        [[nodiscard]] const unsigned char* data() const noexcept { return data_; }
+        [[nodiscard]] size_t size() const noexcept { return size_; }
+        [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] bool is_inline() const noexcept { return data_ == inline_; }
+        [[nodiscard]] std::pmr::memory_resource* resource() const noexcept { return resource_; }
+        // true if the memory resource is a SecureMemoryResource
+        [[nodiscard]] bool is_secure() const noexcept { return secure_; }
+
+        [[nodiscard]] unsigned char* begin() noexcept { return data_; }
+        [[nodiscard]] unsigned char* end() noexcept { return data_ + size_; }
+        [[nodiscard]] const unsigned char* begin() const noexcept { return data_; }
+        [[nodiscard]] const unsigned char* end() const noexcept { return data_ + size_; }
+
+        // unchecked element access, asserted in debug builds
+        unsigned char& operator[](const size_t index) noexcept
+        {
+            JLBA_ASSERT(index < size_, "ByteStorage index out of range");
+            return data_[index];
+        }
+        const unsigned char& operator[](const size_t index) const noexcept
+        {
+            JLBA_ASSERT(index < size_, "ByteStorage index out of range");
+            return data_[index];
+        }
+        unsigned char& back() noexcept
+        {
+            JLBA_ASSERT(size_ > 0, "ByteStorage::back on empty storage");
+            return data_[size_ - 1];
+        }
+
+        // bounds checked element access, throws std::out_of_range
+        unsigned char& at(const size_t index) { check_index_(index); return data_[index]; }
+        [[nodiscard]] const unsigned char& at(const size_t index) const { check_index_(index); return data_[index]; }
+
+        // Ensures capacity() >= new_capacity, never shrinks
+        void reserve(size_t new_capacity);
+        // Resizes, bytes past the old size are set to value
+        void resize(size_t new_size, unsigned char value = 0x00);
+        // Resizes without initialising bytes past the old size, the caller must overwrite them
+        void resize_uninitialized(size_t new_size);
+        // Replaces the contents with [first, first + count)
+        void assign(const unsigned char* first, size_t count);
+        // Appends [first, first + count), the source may point into this storage
+        void append(const unsigned char* first, size_t count);
+        void push_back(unsigned char byte);
+        // Prepends count copies of value, shifting the existing contents right
+        void insert_front(size_t count, unsigned char value);
+        // Removes the first count bytes, shifting the remaining contents left
+        void erase_front(size_t count) noexcept;
+        // Sets the size to zero and keeps the capacity
+        void clear() noexcept { size_ = 0; }
+        // Frees any heap block and returns to the empty inline state
+        void release() noexcept;
+
+        // swaps contents, copying instead of exchanging blocks when the resources differ
+        void swap(ByteStorage& other);
+
+    private:
+        // Moves the contents into a block of exactly new_capacity bytes (new_capacity >= size_)
+        void reallocate_(size_t new_capacity);
+        [[nodiscard]] size_t grown_capacity_(size_t required) const noexcept;
+        void check_index_(const size_t index) const
+        {
+            if (index >= size_) throw std::out_of_range("ByteStorage index out of range");
+        }
+        // Takes over other's contents, this must be empty and inline; leaves other empty and inline.
+        // Heap blocks are only adopted from an equal resource, otherwise they are copied
+        void steal_(ByteStorage& other);
+        [[nodiscard]] unsigned char* allocate_(size_t bytes);
+        void deallocate_(unsigned char* block, size_t bytes) noexcept;
+        // erases the inline buffer if this storage is secure
+        void wipe_inline_() noexcept;
+
+        unsigned char* data_;
+        std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+        size_t size_ = 0;
+        size_t capacity_ = inline_capacity;
+        bool secure_ = false;
+        unsigned char inline_[inline_capacity] = {};
+    };
+}
+
+#endif //BYTE_STORAGE_H
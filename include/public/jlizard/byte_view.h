@@ -0,0 +1,228 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_VIEW_H
+#define BYTE_VIEW_H
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "jlizard/byte_order.h"
+#include "jlizard/debug_assert.h"
+
+namespace jlizard
+{
+    namespace detail
+    {
+        // operator== hands buffers of at least this size to the library, which may split them across cores
+        inline constexpr size_t parallel_compare_floor = 64 * 1024;
+        [[nodiscard]] bool equal_bytes(const unsigned char* a, const unsigned char* b, size_t len) noexcept;
+    }
+
+    /**
+     * @class ByteView
+     * @brief Non-owning, read-only view of a contiguous sequence of bytes
+     *
+     * A thin wrapper around std::span<const unsigned char> that every read-only ByteArray
+     * operation accepts (XOR, complement, comparison, hex and integer conversion), so slices
+     * of network buffers or mapped files can be processed without copying them into a
+     * ByteArray first. ByteArray, std::vector<unsigned char>, std::array and std::span
+     * convert to it implicitly.
+     *
+     * @warning Like std::span, a ByteView does not extend the lifetime of the bytes it refers
+     * to. It is invalidated when the viewed container is modified or destroyed.
+     *
+     * @example
+     * std::vector<unsigned char> packet = receive();
+     * ByteView payload = ByteView(packet).subview(header_size);
+     * ByteArray masked = payload ^ key;         // no copy of the payload
+     * std::string hex = payload.first(4).as_hex_string();
+     */
+    class ByteView
+    {
+    public:
+        using value_type = unsigned char;
+        using iterator = const unsigned char*;
+        using const_iterator = const unsigned char*;
+
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        constexpr ByteView() noexcept = default;
+        constexpr ByteView(const unsigned char* data, const size_t size) noexcept : bytes_(data, size) {}
+        constexpr ByteView(const std::span<const unsigned char> bytes) noexcept : bytes_(bytes) {}
+
+        /**
+         * @brief Views any contiguous, sized range of unsigned char (ByteArray, std::vector, std::array...)
+         */
+        template <typename Range>
+            requires (!std::is_same_v<std::remove_cvref_t<Range>, ByteView>) &&
+                     std::ranges::contiguous_range<const Range&> &&
+                     std::ranges::sized_range<const Range&> &&
+                     std::is_same_v<std::ranges::range_value_t<const Range&>, unsigned char>
+        constexpr ByteView(const Range& range) noexcept // NOLINT(google-explicit-constructor)
+            : bytes_(std::ranges::data(range), std::ranges::size(range)) {}
+
+        [[nodiscard]] constexpr const unsigned char* data() const noexcept { return bytes_.data(); }
+        [[nodiscard]] constexpr size_t size() const noexcept { return bytes_.size(); }
+        [[nodiscard]] constexpr bool empty() const noexcept { return bytes_.empty(); }
+        [[nodiscard]] constexpr const_iterator begin() const noexcept { return bytes_.data(); }
+        [[nodiscard]] constexpr const_iterator end() const noexcept { return bytes_.data() + bytes_.size(); }
+        [[nodiscard]] constexpr std::span<const unsigned char> span() const noexcept { return bytes_; }
+
+        // unchecked element access, asserted in debug builds
+        constexpr const unsigned char& operator[](const size_t index) const noexcept
+        {
+            JLBA_ASSERT(index < bytes_.size(), "ByteView index out of range");
+            return bytes_[index];
+        }
+
+        /**
+         * @brief Bounds checked element access
+         * @throws std::out_of_range If index >= size()
+         */
+        [[nodiscard]] constexpr const unsigned char& at(const size_t index) const
+        {
+            if (index >= bytes_.size()) throw std::out_of_range("ByteView index out of range");
+            return bytes_[index];
+        }
+
+        /**
+         * @brief Returns a view of [offset, offset + count), count is clamped to the bytes available
+         * @throws std::out_of_range If offset > size()
+         */
+        [[nodiscard]] constexpr ByteView subview(const size_t offset, const size_t count = npos) const
+        {
+            if (offset > bytes_.size()) throw std::out_of_range("ByteView offset out of range");
+            return bytes_.subspan(offset, std::min(count, bytes_.size() - offset));
+        }
+
+        // view of the first min(count, size()) bytes
+        [[nodiscard]] constexpr ByteView first(const size_t count) const noexcept
+        {
+            return bytes_.first(std::min(count, bytes_.size()));
+        }
+
+        // view of the last min(count, size()) bytes
+        [[nodiscard]] constexpr ByteView last(const size_t count) const noexcept
+        {
+            return bytes_.last(std::min(count, bytes_.size()));
+        }
+
+        /**
+         * @brief Converts the viewed bytes to a 64-bit unsigned integer (big-endian)
+         * @throws std::invalid_argument If the view is larger than 8 bytes
+         */
+        [[nodiscard]] uint64_t as_64bit_uint() const;
+
+        /**
+         * @brief Converts the viewed bytes to an unsigned integer in the given byte order
+         *
+         * Views shorter than sizeof(T) are read as if the missing most significant bytes were zero.
+         *
+         * @throws std::invalid_argument If the view is larger than sizeof(T) bytes
+         */
+        template <CodecIntegral T, EByteOrder Order = EByteOrder::NETWORK>
+        [[nodiscard]] T as_integral() const
+        {
+            if (size() > sizeof(T)) {
+                throw std::invalid_argument("Byte array is larger than the requested integer type");
+            }
+            return byte_order::load<T, Order>(data(), size());
+        }
+
+        // lowercase hex string of the viewed bytes
+        [[nodiscard]] std::string as_hex_string() const;
+
+        // appends the lowercase hex encoding of the viewed bytes to out
+        void append_hex_to(std::string& out) const;
+
+        /**
+         * @brief Writes the lowercase hex encoding into [first, last) without a terminator
+         * @return {first + 2 * size(), errc{}} or {last, std::errc::value_too_large} if the buffer is too small
+         */
+        std::to_chars_result to_hex_chars(char* first, char* last) const noexcept;
+
+        // exits at the first difference, use secure_equals() for secret data such as MAC tags
+        friend constexpr bool operator==(const ByteView lhs, const ByteView rhs) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                return std::ranges::equal(lhs.bytes_, rhs.bytes_);
+            }
+            if (lhs.size() != rhs.size()) return false;
+            if (lhs.size() >= detail::parallel_compare_floor) return detail::equal_bytes(lhs.data(), rhs.data(), lhs.size());
+            return lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+        }
+
+    private:
+        std::span<const unsigned char> bytes_;
+    };
+
+    /**
+     * @brief Compares two byte sequences in constant time
+     *
+     * Every byte of both operands is examined (SIMD or word wide OR of the XORed bytes) and
+     * the running time depends only on the length, never on where the operands differ. Use
+     * it instead of operator== for MAC tags, password hashes and other secrets.
+     *
+     * @note The sizes are compared first and unequal sizes return immediately, so the
+     * length itself is not hidden.
+     *
+     * @example
+     * if (!secure_equals(received_tag, expected_tag)) throw std::runtime_error("bad tag");
+     */
+    [[nodiscard]] bool secure_equals(ByteView a, ByteView b) noexcept;
+
+    /**
+     * @brief Number of set bits (Hamming weight), counted a SIMD register at a time
+     */
+    [[nodiscard]] uint64_t popcount(ByteView bytes) noexcept;
+
+    /**
+     * @brief Number of differing bits between two byte sequences (right-aligned)
+     *
+     * The shorter operand is implicitly zero-padded on the left like for XOR, so every set bit
+     * in the longer operand's excess prefix counts as a difference. Equivalent to
+     * `popcount(ByteArray(a ^ b))` without materialising the XOR.
+     *
+     * @example
+     * const auto distance = hamming_distance(fuzzy_hash, candidate);  // similarity digests
+     */
+    [[nodiscard]] uint64_t hamming_distance(ByteView a, ByteView b) noexcept;
+}
+
+// with BYTEAO_INLINE_HOT_PATHS the small-array paths are defined here instead of in the library
+#if defined(JLBA_INLINE_HOT_PATHS)
+#include "jlizard/byte_view_inline.h"
+#endif
+
+#endif //BYTE_VIEW_H
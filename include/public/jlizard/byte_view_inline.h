@@ -0,0 +1,50 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_VIEW_INLINE_H
+#define BYTE_VIEW_INLINE_H
+
+#include <stdexcept>
+
+#include "jlizard/byte_order.h"
+#include "jlizard/byte_view.h"
+#include "jlizard/inline_hot_paths.h"
+
+// Hot path definitions of ByteView, inline in the headers or compiled into the library, see inline_hot_paths.h
+
+namespace jlizard
+{
+    JLBA_HOT_INLINE uint64_t ByteView::as_64bit_uint() const
+    {
+        if (size() > sizeof(uint64_t)) {
+            throw std::invalid_argument("Byte array is larger than 64-bit and cannot be represented as such");
+        }
+
+        // big-endian, right-aligned in a zeroed word
+        return byte_order::load<uint64_t, EByteOrder::MSB_FIRST>(data(), size());
+    }
+}
+
+#endif //BYTE_VIEW_INLINE_H
@@ -0,0 +1,140 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef BYTE_WRITER_H
+#define BYTE_WRITER_H
+
+#include <cstddef>
+#include <cstring>
+
+#include "jlizard/byte_array.h"
+#include "jlizard/byte_order.h"
+#include "jlizard/byte_view.h"
+
+namespace jlizard
+{
+    /**
+     * @class ByteWriter
+     * @brief Append cursor for building frames directly in a ByteArray
+     *
+     * Writes go to the target's spare capacity through a raw cursor, so as long as they fit
+     * in the capacity (e.g. of a create_with_prealloc() buffer) appending costs one copy and
+     * never reallocates. Writing past the capacity grows the block geometrically like
+     * ByteArray::append().
+     *
+     * The target's size() is only updated by flush() and by the destructor. While the writer
+     * is alive the target must not be modified by other means; reading it after a flush() is
+     * fine.
+     *
+     * @example
+     * ByteArray frame = ByteArray::create_with_prealloc(1500);
+     * {
+     *     ByteWriter writer(frame);
+     *     writer.put(0x17).write_integral<uint16_t>(0x0303).write_integral<uint16_t>(payload.size());
+     *     writer.write(payload);
+     * } // frame now holds the 5 byte header followed by the payload
+     */
+    class ByteWriter
+    {
+    public:
+        // starts writing at target.size(), the existing contents are kept
+        explicit ByteWriter(ByteArray& target) noexcept
+            : target_(target), begin_(target.bytes_.data()), cursor_(begin_ + target.bytes_.size()),
+              end_(begin_ + target.bytes_.capacity()), start_size_(target.bytes_.size())
+        {
+        }
+
+        ByteWriter(const ByteWriter&) = delete;
+        ByteWriter& operator=(const ByteWriter&) = delete;
+
+        ~ByteWriter() { flush(); }
+
+        // appends one byte
+        ByteWriter& put(const unsigned char byte)
+        {
+            if (cursor_ == end_) grow_(1);
+            *cursor_++ = byte;
+            return *this;
+        }
+
+        // appends the bytes of a view, which may view the target itself
+        ByteWriter& write(const ByteView bytes) { return write(bytes.data(), bytes.size()); }
+
+        // appends size bytes read from data
+        ByteWriter& write(const void* data, const size_t size)
+        {
+            if (size > remaining()) {
+                write_slow_(static_cast<const unsigned char*>(data), size);
+                return *this;
+            }
+            if (size > 0) std::memcpy(cursor_, data, size);
+            cursor_ += size;
+            return *this;
+        }
+
+        // appends the sizeof(T) byte encoding of value, network order (MSB first) by default
+        template <CodecIntegral T, EByteOrder Order = EByteOrder::NETWORK>
+        ByteWriter& write_integral(const T value)
+        {
+            if (sizeof(T) > remaining()) grow_(sizeof(T));
+            byte_order::store<Order>(value, cursor_);
+            cursor_ += sizeof(T);
+            return *this;
+        }
+
+        // appends count copies of value
+        ByteWriter& fill(size_t count, unsigned char value);
+
+        // bytes appended through this writer so far
+        [[nodiscard]] size_t written() const noexcept
+        {
+            return static_cast<size_t>(cursor_ - begin_) - start_size_;
+        }
+
+        // bytes that can still be written without reallocating
+        [[nodiscard]] size_t remaining() const noexcept { return static_cast<size_t>(end_ - cursor_); }
+
+        // publishes the bytes written so far in the target's size()
+        void flush() noexcept
+        {
+            // the bytes are already in place and within the capacity, this never reallocates
+            target_.bytes_.resize_uninitialized(static_cast<size_t>(cursor_ - begin_));
+        }
+
+    private:
+        // makes room for at least extra more bytes, growing the block geometrically
+        void grow_(size_t extra);
+        // write() of a range that does not fit in the remaining capacity
+        void write_slow_(const unsigned char* data, size_t size);
+
+        ByteArray& target_;
+        unsigned char* begin_;
+        unsigned char* cursor_;
+        unsigned char* end_;
+        size_t start_size_;
+    };
+}
+
+#endif //BYTE_WRITER_H
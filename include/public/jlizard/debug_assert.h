@@ -0,0 +1,57 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef DEBUG_ASSERT_H
+#define DEBUG_ASSERT_H
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @file debug_assert.h
+ * @brief Assertions guarding the unchecked accessors
+ *
+ * JLBA_ASSERT is active in debug builds (NDEBUG not defined) and in any build configured
+ * with the CMake option BYTEAO_ENABLE_ASSERTS (which defines JLBA_ENABLE_ASSERTS). Otherwise
+ * it compiles to nothing, so unchecked accessors cost exactly a pointer access.
+ */
+#if !defined(NDEBUG) || defined(JLBA_ENABLE_ASSERTS)
+#define JLBA_ASSERTS_ENABLED 1
+#define JLBA_ASSERT(condition, message) \
+    ((condition) ? static_cast<void>(0) : ::jlizard::detail::assertion_failed(#condition, message, __FILE__, __LINE__))
+#else
+#define JLBA_ASSERT(condition, message) static_cast<void>(0)
+#endif
+
+namespace jlizard::detail
+{
+    [[noreturn]] inline void assertion_failed(const char* condition, const char* message, const char* file, const int line) noexcept
+    {
+        std::fprintf(stderr, "%s:%d: byte-ao assertion '%s' failed: %s\n", file, line, condition, message);
+        std::abort();
+    }
+}
+
+#endif //DEBUG_ASSERT_H
@@ -0,0 +1,245 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef FIXED_BYTE_ARRAY_H
+#define FIXED_BYTE_ARRAY_H
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "jlizard/byte_array.h"
+#include "jlizard/byte_view.h"
+
+namespace jlizard
+{
+    namespace detail
+    {
+        // securely erases and verifies [data, data + size), see ByteArray::secure_wipe()
+        bool secure_wipe_bytes(unsigned char* data, size_t size);
+
+        constexpr unsigned char hex_nibble(const char c)
+        {
+            if (c >= '0' && c <= '9') return static_cast<unsigned char>(c - '0');
+            if (c >= 'a' && c <= 'f') return static_cast<unsigned char>(c - 'a' + 10);
+            if (c >= 'A' && c <= 'F') return static_cast<unsigned char>(c - 'A' + 10);
+            throw std::runtime_error("Invalid hex character");
+        }
+    }
+
+    /**
+     * @class FixedByteArray
+     * @brief Byte array whose size is fixed at compile time
+     *
+     * Holds exactly N bytes in a std::array: no allocation, trivially copyable and usable in
+     * constant expressions. Intended for values like 16 byte AES blocks, 32 byte keys or
+     * 12 byte nonces. Operands always have the same size, so XOR needs no alignment and the
+     * fixed-count loops can be fully unrolled or vectorized by the compiler.
+     *
+     * The API mirrors ByteArray (XOR, complement, comparison, hex, secure_wipe) and the array
+     * converts to ByteView implicitly, so it can be mixed with ByteArray operands. Conversion
+     * from a ByteArray goes through the pad/truncate constructor
+     * ByteArray(const ByteArray&, size_t, EZeroPadDir).
+     *
+     * @warning Being trivially copyable, copies are not wiped automatically. Call
+     * secure_wipe() on every copy holding secrets.
+     *
+     * @tparam N Number of bytes
+     *
+     * @example
+     * constexpr FixedByteArray<4> magic("deadbeef");
+     * FixedByteArray<16> block = FixedByteArray<16>::from(ciphertext);   // pads or truncates
+     * block ^= iv;
+     * std::string hex = block.as_hex_string();
+     */
+    template <size_t N>
+    class FixedByteArray
+    {
+    public:
+        static_assert(N > 0, "FixedByteArray must hold at least one byte");
+
+        using value_type = unsigned char;
+        using iterator = unsigned char*;
+        using const_iterator = const unsigned char*;
+
+        static constexpr size_t SIZE = N;
+
+        // all bytes zero
+        constexpr FixedByteArray() noexcept = default;
+
+        constexpr explicit FixedByteArray(const std::array<unsigned char, N>& bytes) noexcept : bytes_(bytes) {}
+
+        // every byte set to value
+        static constexpr FixedByteArray filled(const unsigned char value) noexcept
+        {
+            FixedByteArray result;
+            result.bytes_.fill(value);
+            return result;
+        }
+
+        /**
+         * @brief Constructs from exactly N bytes
+         * @throws std::invalid_argument If the list does not hold exactly N bytes
+         */
+        constexpr FixedByteArray(const std::initializer_list<unsigned char> bytes)
+        {
+            if (bytes.size() != N) {
+                throw std::invalid_argument("Initializer list size does not match the FixedByteArray size");
+            }
+            size_t i = 0;
+            for (const unsigned char byte : bytes) {
+                bytes_[i++] = byte;
+            }
+        }
+
+        /**
+         * @brief Decodes exactly 2 * N hex characters
+         * @throws std::invalid_argument If hex_str does not hold exactly 2 * N characters
+         * @throws std::runtime_error If hex_str contains a non-hexadecimal character
+         */
+        constexpr explicit FixedByteArray(const std::string_view hex_str)
+        {
+            if (hex_str.size() != 2 * N) {
+                throw std::invalid_argument("Hex string length does not match the FixedByteArray size");
+            }
+            for (size_t i = 0; i < N; ++i) {
+                bytes_[i] = static_cast<unsigned char>((detail::hex_nibble(hex_str[2 * i]) << 4) |
+                                                       detail::hex_nibble(hex_str[2 * i + 1]));
+            }
+        }
+
+        /**
+         * @brief Converts a ByteArray by padding or truncating it to N bytes
+         *
+         * @param other The source ByteArray of any size
+         * @param zero_pad_dir Padding / truncation direction, as for ByteArray(const ByteArray&, size_t, EZeroPadDir)
+         */
+        static FixedByteArray from(const ByteArray& other, const EZeroPadDir zero_pad_dir = EZeroPadDir::DEFAULT_PAD)
+        {
+            const ByteArray resized(other, N, zero_pad_dir);
+            FixedByteArray result;
+            std::copy_n(resized.begin(), N, result.bytes_.begin());
+            return result;
+        }
+
+        // copies the bytes into a dynamic ByteArray
+        [[nodiscard]] ByteArray to_byte_array() const { return ByteArray(ByteView(*this)); }
+
+        [[nodiscard]] static constexpr size_t size() noexcept { return N; }
+        [[nodiscard]] static constexpr bool empty() noexcept { return false; }
+        [[nodiscard]] constexpr unsigned char* data() noexcept { return bytes_.data(); }
+        [[nodiscard]] constexpr const unsigned char* data() const noexcept { return bytes_.data(); }
+        [[nodiscard]] constexpr iterator begin() noexcept { return bytes_.data(); }
+        [[nodiscard]] constexpr iterator end() noexcept { return bytes_.data() + N; }
+        [[nodiscard]] constexpr const_iterator begin() const noexcept { return bytes_.data(); }
+        [[nodiscard]] constexpr const_iterator end() const noexcept { return bytes_.data() + N; }
+        [[nodiscard]] constexpr const std::array<unsigned char, N>& array() const noexcept { return bytes_; }
+
+        // unchecked element access, asserted in debug builds
+        constexpr unsigned char& operator[](const size_t index) noexcept
+        {
+            JLBA_ASSERT(index < N, "FixedByteArray index out of range");
+            return bytes_[index];
+        }
+        constexpr const unsigned char& operator[](const size_t index) const noexcept
+        {
+            JLBA_ASSERT(index < N, "FixedByteArray index out of range");
+            return bytes_[index];
+        }
+
+        // bounds checked element access, throws std::out_of_range
+        constexpr unsigned char& at(const size_t index) { return bytes_.at(index); }
+        [[nodiscard]] constexpr const unsigned char& at(const size_t index) const { return bytes_.at(index); }
+
+        // Logical Operations Begin
+        constexpr FixedByteArray& operator^=(const FixedByteArray& other) noexcept
+        {
+            for (size_t i = 0; i < N; ++i) {
+                bytes_[i] ^= other.bytes_[i];
+            }
+            return *this;
+        }
+
+        [[nodiscard]] constexpr FixedByteArray operator^(const FixedByteArray& other) const noexcept
+        {
+            FixedByteArray result(*this);
+            result ^= other;
+            return result;
+        }
+
+        // XOR a single byte into the last byte, as ByteArray::operator^=(unsigned char)
+        constexpr FixedByteArray& operator^=(const unsigned char byte) noexcept
+        {
+            bytes_[N - 1] ^= byte;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr FixedByteArray operator^(const unsigned char byte) const noexcept
+        {
+            FixedByteArray result(*this);
+            result ^= byte;
+            return result;
+        }
+
+        // 1's complement operator (unary ~)
+        [[nodiscard]] constexpr FixedByteArray operator~() const noexcept
+        {
+            FixedByteArray result;
+            for (size_t i = 0; i < N; ++i) {
+                result.bytes_[i] = static_cast<unsigned char>(~bytes_[i]);
+            }
+            return result;
+        }
+
+        constexpr bool operator==(const FixedByteArray& other) const noexcept = default;
+        // Logical operation end
+
+        // lowercase hex string, as ByteArray::as_hex_string()
+        [[nodiscard]] std::string as_hex_string() const { return ByteView(*this).as_hex_string(); }
+        void append_hex_to(std::string& out) const { ByteView(*this).append_hex_to(out); }
+        std::to_chars_result to_hex_chars(char* first, char* last) const noexcept
+        {
+            return ByteView(*this).to_hex_chars(first, last);
+        }
+
+        /**
+         * @brief Securely erases the bytes, the array holds N zero bytes afterwards
+         *
+         * @return true if the erasure was verified
+         * @throws security::unsafe::ErasureVerificationError If verification fails
+         */
+        bool secure_wipe() { return detail::secure_wipe_bytes(bytes_.data(), N); }
+
+    private:
+        std::array<unsigned char, N> bytes_{};
+    };
+}
+
+#endif //FIXED_BYTE_ARRAY_H
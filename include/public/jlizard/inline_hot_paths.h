@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef INLINE_HOT_PATHS_H
+#define INLINE_HOT_PATHS_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file inline_hot_paths.h
+ * @brief Small-array fast paths and the switch that moves them into the headers
+ *
+ * The trivial wrappers on the small-array paths (single byte XOR, in place XOR of short
+ * operands, integer conversion) are defined in byte_view_inline.h and byte_array_inline.h.
+ * By default those files are compiled into the library like any other source. Building with
+ * the CMake option BYTEAO_INLINE_HOT_PATHS (which defines JLBA_INLINE_HOT_PATHS for the
+ * library and every consumer) includes them from the public headers instead, so the calls
+ * inline into user code without link time optimisation.
+ *
+ * Operands of at most inline_kernel_ceiling bytes are processed by the loops below rather
+ * than a runtime dispatched SIMD kernel, the kernel lookup costs more than the work there.
+ */
+#if defined(JLBA_INLINE_HOT_PATHS)
+#define JLBA_HOT_INLINE inline
+#else
+#define JLBA_HOT_INLINE
+#endif
+
+namespace jlizard::detail
+{
+    // largest operand handled without going through the kernel table
+    inline constexpr size_t inline_kernel_ceiling = 64;
+
+    // true if [a, a + a_len) and [b, b + b_len) share at least one byte
+    inline bool ranges_overlap(const unsigned char* a, const size_t a_len, const unsigned char* b,
+                               const size_t b_len) noexcept
+    {
+        if (a_len == 0 || b_len == 0) return false;
+        const auto a_begin = reinterpret_cast<std::uintptr_t>(a);
+        const auto b_begin = reinterpret_cast<std::uintptr_t>(b);
+        return a_begin < b_begin + b_len && b_begin < a_begin + a_len;
+    }
+
+    // out[i] = a[i] ^ b[i], out may alias a or b exactly
+    constexpr void xor_small(const unsigned char* a, const unsigned char* b, unsigned char* out,
+                             const size_t len) noexcept
+    {
+        for (size_t i = 0; i < len; ++i) {
+            out[i] = static_cast<unsigned char>(a[i] ^ b[i]);
+        }
+    }
+}
+
+#endif //INLINE_HOT_PATHS_H
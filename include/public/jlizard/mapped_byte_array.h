@@ -0,0 +1,163 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef MAPPED_BYTE_ARRAY_H
+#define MAPPED_BYTE_ARRAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include "jlizard/byte_view.h"
+#include "jlizard/debug_assert.h"
+
+namespace jlizard
+{
+    class ByteArray;
+
+    /**
+     * @brief How MappedByteArray maps a file
+     *
+     * READ_ONLY maps the pages read-only, writing through the mapping is rejected.
+     * COPY_ON_WRITE maps them privately writable: the first write to a page gives the process
+     * its own copy, the file itself is never modified.
+     */
+    enum class EMapMode : std::uint8_t
+    {
+        READ_ONLY = 1,
+        COPY_ON_WRITE = 2
+    };
+
+    /**
+     * @class MappedByteArray
+     * @brief Byte array backed by a memory mapped file (mmap / MapViewOfFile)
+     *
+     * Opening a file only maps it, pages are read in by the operating system on first access,
+     * so loading a large blob costs no copy and no up-front read. The contents convert
+     * implicitly to ByteView, which means XOR, complement, comparison, secure_equals() and
+     * hex conversion run directly on the mapped pages.
+     *
+     * The mapping is move-only and unmapped on destruction. An empty file gives an empty
+     * array without a mapping, the file is closed as soon as the mapping exists.
+     *
+     * @warning Modifying or truncating the file while it is mapped changes or invalidates the
+     * contents (truncation may raise SIGBUS on POSIX systems), as with any file mapping.
+     *
+     * @example
+     * MappedByteArray store("keys.bin");
+     * ByteArray key = store.view().subview(offset, 32) ^ mask;   // only the touched pages are read
+     *
+     * MappedByteArray scratch("blob.bin", EMapMode::COPY_ON_WRITE);
+     * scratch[0] ^= 0xFF;          // private copy of the first page, blob.bin is unchanged
+     * scratch.secure_wipe();
+     */
+    class MappedByteArray
+    {
+    public:
+        using value_type = unsigned char;
+        using iterator = unsigned char*;
+        using const_iterator = const unsigned char*;
+
+        MappedByteArray() noexcept = default;
+
+        /**
+         * @brief Maps the whole file at path
+         * @throws std::system_error If the file cannot be opened, inspected or mapped
+         */
+        explicit MappedByteArray(const std::filesystem::path& path, EMapMode mode = EMapMode::READ_ONLY);
+
+        MappedByteArray(const MappedByteArray&) = delete;
+        MappedByteArray& operator=(const MappedByteArray&) = delete;
+        MappedByteArray(MappedByteArray&& other) noexcept;
+        MappedByteArray& operator=(MappedByteArray&& other) noexcept;
+        ~MappedByteArray();
+
+        [[nodiscard]] const unsigned char* data() const noexcept { return data_; }
+        [[nodiscard]] size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] EMapMode mode() const noexcept { return mode_; }
+        [[nodiscard]] bool is_writable() const noexcept { return mode_ == EMapMode::COPY_ON_WRITE; }
+        [[nodiscard]] const_iterator begin() const noexcept { return data_; }
+        [[nodiscard]] const_iterator end() const noexcept { return data_ + size_; }
+
+        // MappedByteArray also converts implicitly to ByteView as a contiguous range
+        [[nodiscard]] ByteView view() const noexcept { return {data_, size_}; }
+
+        // unchecked element access, asserted in debug builds
+        const unsigned char& operator[](const size_t index) const noexcept
+        {
+            JLBA_ASSERT(index < size_, "MappedByteArray index out of range");
+            return data_[index];
+        }
+
+        /**
+         * @brief Writable element access, only in COPY_ON_WRITE mode (asserted in debug builds)
+         *
+         * Writes go to a private copy of the page and never reach the file.
+         */
+        unsigned char& operator[](const size_t index) noexcept
+        {
+            JLBA_ASSERT(index < size_, "MappedByteArray index out of range");
+            JLBA_ASSERT(is_writable(), "MappedByteArray is mapped read-only");
+            return data_[index];
+        }
+
+        /**
+         * @brief Writable access to the mapped bytes
+         * @throws std::logic_error If the file is mapped READ_ONLY
+         */
+        [[nodiscard]] unsigned char* mutable_data();
+
+        [[nodiscard]] std::string as_hex_string() const { return view().as_hex_string(); }
+
+        // copies the contents into an owning ByteArray
+        [[nodiscard]] ByteArray to_byte_array() const;
+
+        /**
+         * @brief Securely erases the private pages and unmaps the file
+         *
+         * Every page is overwritten through the copy-on-write mapping, so the erasure only
+         * touches the process' private copies and the file keeps its contents. Afterwards
+         * the array is empty.
+         *
+         * @return true once the erasure has been verified
+         * @throws security::unsafe::ErasureVerificationError If verification fails
+         * @throws std::logic_error If the file is mapped READ_ONLY, its pages are shared with
+         *         the page cache and cannot be erased; unmap them with reset() instead
+         */
+        bool secure_wipe();
+
+        // unmaps the file, leaving the array empty
+        void reset() noexcept;
+
+    private:
+        unsigned char* data_ = nullptr;
+        size_t size_ = 0;
+        EMapMode mode_ = EMapMode::READ_ONLY;
+    };
+}
+
+#endif //MAPPED_BYTE_ARRAY_H
@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <cstddef>
+
+namespace jlizard::parallel
+{
+    /**
+     * @brief When and how bulk operations are spread across cores
+     *
+     * XOR, complement, equality (operator== and secure_equals) and secure erasure of buffers of
+     * at least `threshold` bytes are split into `chunk_size` pieces that an internal pool of
+     * worker threads and the calling thread process together. Smaller buffers, and every
+     * operation in a build with BYTEAO_ENABLE_PARALLEL=OFF, stay on the calling thread.
+     *
+     * The defaults keep the thread hand-off (a few microseconds) well below the time a single
+     * core spends on a buffer of `threshold` bytes.
+     */
+    struct Config
+    {
+        /// smallest buffer processed in parallel, operator== only considers buffers >= 64 KiB
+        size_t threshold = 4 << 20;
+        /// bytes handed to a thread at a time, a few hundred KiB keep each piece in the L2 cache
+        size_t chunk_size = 256 << 10;
+        /// threads working on one operation including the caller, 0 means one per hardware thread,
+        /// larger values oversubscribe the cores
+        unsigned max_threads = 0;
+
+        bool operator==(const Config&) const = default;
+    };
+
+    /**
+     * @brief Replaces the process wide configuration, safe to call from any thread
+     *
+     * @example
+     * parallel::set_config({.threshold = 64 << 20, .max_threads = 4});  // fewer, larger jobs
+     * parallel::set_config({.max_threads = 1});                         // fully single threaded
+     *
+     * @throws std::invalid_argument If chunk_size is zero
+     */
+    void set_config(const Config& config);
+
+    [[nodiscard]] Config config() noexcept;
+
+    /**
+     * @brief Number of threads a parallel operation would currently use, including the caller
+     *
+     * Always 1 when built with BYTEAO_ENABLE_PARALLEL=OFF.
+     */
+    [[nodiscard]] unsigned thread_count() noexcept;
+}
+
+#endif //PARALLEL_H
@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace jlizard
+{
+    /**
+     * @brief Where random bytes are drawn from
+     *
+     * SYSTEM asks the operating system CSPRNG for every request (getrandom on Linux,
+     * arc4random_buf on macOS/BSD, BCryptGenRandom on Windows). THREAD_DRBG serves bytes from
+     * a per-thread ChaCha20 generator seeded from the system CSPRNG, which avoids a system
+     * call per request and is the better choice for many small requests such as nonces.
+     */
+    enum class ERandomSource : std::uint8_t
+    {
+        SYSTEM = 1,
+        THREAD_DRBG = 2
+    };
+
+    namespace random
+    {
+        /**
+         * @brief Fills [out, out + count) from the operating system CSPRNG
+         *
+         * Large requests are split into the chunks the platform accepts and interrupted
+         * calls are retried, so the whole range is always filled.
+         *
+         * @throws std::runtime_error If the operating system cannot provide random bytes
+         */
+        void fill_system(unsigned char* out, size_t count);
+
+        /**
+         * @class ChaCha20Drbg
+         * @brief Buffered ChaCha20 deterministic random bit generator
+         *
+         * Keystream is produced a batch of blocks at a time and served from an internal
+         * buffer. After every batch the first 32 bytes of fresh keystream become the next key
+         * and are erased (fast key erasure), so a later compromise of the state does not
+         * reveal bytes handed out before it. Requests of at least a full batch are written
+         * straight into the destination.
+         *
+         * A generator seeded from the system reseeds itself after `reseed_interval` bytes
+         * and in a child process after fork(). A generator constructed from an explicit seed
+         * is fully deterministic and never reseeds on its own.
+         *
+         * The state is securely erased on destruction. Instances are not thread-safe, use
+         * thread_drbg() for a per-thread generator.
+         */
+        class ChaCha20Drbg
+        {
+        public:
+            static constexpr size_t key_size = 32;
+            static constexpr size_t block_size = 64;
+            // number of keystream blocks generated per refill
+            static constexpr size_t batch_blocks = 16;
+            // bytes served before a system seeded generator fetches a new key
+            static constexpr size_t reseed_interval = 1024 * 1024;
+
+            /**
+             * @brief Constructs a generator seeded from the system CSPRNG
+             *
+             * @throws std::runtime_error If the operating system cannot provide random bytes
+             */
+            ChaCha20Drbg();
+            /**
+             * @brief Constructs a deterministic generator, mainly for reproducible tests
+             *
+             * @param seed The initial ChaCha20 key
+             */
+            explicit ChaCha20Drbg(std::span<const unsigned char, key_size> seed) noexcept;
+            ChaCha20Drbg(const ChaCha20Drbg&) = delete;
+            ChaCha20Drbg& operator=(const ChaCha20Drbg&) = delete;
+            ~ChaCha20Drbg();
+
+            /**
+             * @brief Fills [out, out + count) with keystream
+             *
+             * @throws std::runtime_error If an automatic reseed fails
+             */
+            void fill(unsigned char* out, size_t count);
+            /**
+             * @brief Replaces the key with fresh bytes from the system CSPRNG and drops buffered output
+             *
+             * @throws std::runtime_error If the operating system cannot provide random bytes
+             */
+            void reseed();
+
+        private:
+            // generates batch_blocks blocks into buffer_ and rotates the key
+            void refill_() noexcept;
+            // writes whole blocks of keystream for the current key to out
+            void generate_blocks_(unsigned char* out, size_t blocks) noexcept;
+            // reseeds if the interval is used up or the process has forked
+            void maybe_reseed_();
+
+            std::array<unsigned char, key_size> key_{};
+            std::array<unsigned char, block_size * batch_blocks> buffer_{};
+            // length of the unread tail of buffer_
+            size_t available_ = 0;
+            std::uint32_t counter_ = 0;
+            size_t since_reseed_ = 0;
+            bool auto_reseed_ = true;
+            unsigned fork_generation_ = 0;
+        };
+
+        /**
+         * @brief The calling thread's system seeded ChaCha20Drbg, created on first use
+         *
+         * @throws std::runtime_error If the generator cannot be seeded
+         */
+        ChaCha20Drbg& thread_drbg();
+
+        /**
+         * @brief Fills [out, out + count) from the given source
+         *
+         * @throws std::runtime_error If the source cannot provide random bytes
+         */
+        void fill(unsigned char* out, size_t count, ERandomSource source);
+
+        namespace detail
+        {
+            /**
+             * @brief The ChaCha20 block function of RFC 8439
+             *
+             * @param key The 256-bit key
+             * @param counter The 32-bit block counter
+             * @param nonce The 96-bit nonce
+             * @param out Receives the 64 bytes of serialized keystream
+             */
+            void chacha20_block(std::span<const unsigned char, 32> key, std::uint32_t counter,
+                                std::span<const unsigned char, 12> nonce, std::span<unsigned char, 64> out) noexcept;
+        }
+    }
+}
+
+#endif //RANDOM_H
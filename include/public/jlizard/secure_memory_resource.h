@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef SECURE_MEMORY_RESOURCE_H
+#define SECURE_MEMORY_RESOURCE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+namespace jlizard
+{
+    /**
+     * @class SecureMemoryResource
+     * @brief Memory resource that securely erases every block when it is deallocated
+     *
+     * Allocations are forwarded to an upstream resource. On deallocation the whole block is
+     * erased with the platform's secure zeroing primitive before it is handed back, so
+     * memory released by reallocation during concat()/resize() or by destruction never
+     * keeps its old contents. ByteArrays allocating from this resource additionally erase
+     * their inline small buffer whenever its contents move or are released, and their
+     * secure_wipe() skips the separate erase and verify pass.
+     *
+     * The resource keeps a count of live blocks and bytes, which can be used to check that
+     * all sensitive allocations have been returned (and therefore erased).
+     *
+     * @note Copies of a ByteArray made without an allocator use the default resource, pass
+     * the secure resource explicitly to keep copies protected.
+     *
+     * @example
+     * ByteArray key(jlizard::secure_resource());
+     * key.concat(ByteArray("deadbeef"));   // every block the key ever used is erased on release
+     * ByteArray key_copy(key, jlizard::secure_resource());
+     */
+    class SecureMemoryResource : public std::pmr::memory_resource
+    {
+    public:
+        /**
+         * @brief Constructs a secure resource on top of the given upstream resource
+         *
+         * @param upstream The resource that provides the memory, must outlive this resource
+         */
+        explicit SecureMemoryResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+            : upstream_(upstream) {}
+
+        SecureMemoryResource(const SecureMemoryResource&) = delete;
+        SecureMemoryResource& operator=(const SecureMemoryResource&) = delete;
+
+        [[nodiscard]] std::pmr::memory_resource* upstream_resource() const noexcept { return upstream_; }
+        /**
+         * @brief Number of blocks allocated from this resource that have not been deallocated yet
+         */
+        [[nodiscard]] size_t live_blocks() const noexcept { return live_blocks_.load(std::memory_order_relaxed); }
+        /**
+         * @brief Number of bytes allocated from this resource that have not been deallocated yet
+         */
+        [[nodiscard]] size_t live_bytes() const noexcept { return live_bytes_.load(std::memory_order_relaxed); }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        std::pmr::memory_resource* upstream_;
+        std::atomic<size_t> live_blocks_{0};
+        std::atomic<size_t> live_bytes_{0};
+    };
+
+    /**
+     * @brief Returns the process-wide SecureMemoryResource backed by new/delete
+     */
+    [[nodiscard]] SecureMemoryResource* secure_resource() noexcept;
+}
+
+#endif //SECURE_MEMORY_RESOURCE_H
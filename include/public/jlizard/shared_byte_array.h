@@ -0,0 +1,158 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef SHARED_BYTE_ARRAY_H
+#define SHARED_BYTE_ARRAY_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "jlizard/byte_array.h"
+#include "jlizard/byte_view.h"
+
+namespace jlizard
+{
+    /**
+     * @class SharedByteArray
+     * @brief Reference counted, copy-on-write byte array for fanning one payload out to many owners
+     *
+     * All copies and slices of a SharedByteArray refer to the same immutable block, copying
+     * one only bumps an atomic reference count and slice() only narrows the range. The bytes
+     * are deep copied once, on the first mutable access through a handle that shares its
+     * block (or only sees part of it). When the last handle releases a block, the block is
+     * erased with ByteArray::secure_wipe() under the wipe policy of the array it was built from.
+     *
+     * Distinct handles may be used from different threads, one handle must not be mutated
+     * while another thread copies it, as for std::shared_ptr.
+     *
+     * SharedByteArray converts implicitly to ByteView, so XOR, comparison, secure_equals(),
+     * popcount() and hex conversion run on the shared bytes without copying them.
+     *
+     * @example
+     * SharedByteArray message(std::move(payload));      // takes over payload's storage
+     * for (auto& subscriber : subscribers) {
+     *     subscriber.queue.push(message);               // O(1), no byte is copied
+     * }
+     * SharedByteArray header = message.slice(0, 16);    // O(1) as well
+     * header.mutable_data()[0] = 0x01;                  // header gets its own 16 byte copy
+     */
+    class SharedByteArray
+    {
+    public:
+        static constexpr size_t npos = ByteView::npos;
+
+        SharedByteArray() noexcept = default;
+        // takes over the array's storage without copying the bytes
+        explicit SharedByteArray(ByteArray&& bytes);
+        // copies the bytes once into a new shared block
+        explicit SharedByteArray(ByteView bytes);
+
+        SharedByteArray(const SharedByteArray&) noexcept = default;
+        SharedByteArray(SharedByteArray&&) noexcept = default;
+        SharedByteArray& operator=(const SharedByteArray&) noexcept = default;
+        SharedByteArray& operator=(SharedByteArray&&) noexcept = default;
+        ~SharedByteArray() = default;
+
+        [[nodiscard]] const unsigned char* data() const noexcept { return view().data(); }
+        [[nodiscard]] size_t size() const noexcept { return view().size(); }
+        [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+        [[nodiscard]] const unsigned char* begin() const noexcept { return data(); }
+        [[nodiscard]] const unsigned char* end() const noexcept { return data() + size(); }
+
+        [[nodiscard]] ByteView view() const noexcept
+        {
+            if (!block_) return {};
+            return whole_ ? ByteView(*block_) : ByteView(block_->data() + offset_, size_);
+        }
+
+        /**
+         * @brief Bounds checked read access
+         * @throws std::out_of_range If index >= size()
+         */
+        [[nodiscard]] const unsigned char& operator[](size_t index) const;
+
+        /**
+         * @brief A handle to [offset, offset + count) of the same block, count is clamped to the bytes available
+         * @throws std::out_of_range If offset > size()
+         */
+        [[nodiscard]] SharedByteArray slice(size_t offset, size_t count = npos) const;
+
+        // number of handles sharing the block, 0 for an empty default constructed handle
+        [[nodiscard]] long use_count() const noexcept { return block_.use_count(); }
+
+        /**
+         * @brief Writable pointer to this handle's bytes, copying them first if the block is shared
+         *
+         * After the call this handle is the only owner of its block and every other handle
+         * keeps seeing the old bytes.
+         */
+        [[nodiscard]] unsigned char* mutable_data();
+
+        /**
+         * @brief The underlying array for in place operations (^=, resize(), append(), ...)
+         *
+         * Detaches like mutable_data() and additionally copies a slice into a block of its own,
+         * so the returned array holds exactly this handle's bytes. Size changes made through it
+         * are reflected by size(). The reference stays valid until this handle is copied from,
+         * assigned to or reset.
+         */
+        [[nodiscard]] ByteArray& mutable_bytes();
+
+        // a deep copy of the bytes
+        [[nodiscard]] ByteArray to_byte_array() const { return ByteArray(view()); }
+
+        /**
+         * @brief Moves the bytes out, without copying them when this handle owns its whole block alone
+         *
+         * The handle is empty afterwards.
+         */
+        [[nodiscard]] ByteArray release();
+
+        // drops this handle's reference, the block is securely wiped if it was the last one
+        void reset() noexcept;
+
+        [[nodiscard]] std::string as_hex_string() const { return view().as_hex_string(); }
+
+        bool operator==(const SharedByteArray& other) const noexcept { return view() == other.view(); }
+        bool operator==(const ByteArray& other) const noexcept { return view() == ByteView(other); }
+        bool operator==(const ByteView other) const noexcept { return view() == other; }
+
+    private:
+        // keeps shared segments alive without a copy
+        friend class ByteChain;
+
+        // replaces the block by a private copy of this handle's bytes
+        void detach_();
+
+        std::shared_ptr<ByteArray> block_;
+        size_t offset_ = 0;
+        size_t size_ = 0;
+        // true while the handle covers its whole block, offset_ and size_ are unused then
+        bool whole_ = true;
+    };
+}
+
+#endif //SHARED_BYTE_ARRAY_H
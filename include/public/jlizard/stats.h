@@ -0,0 +1,89 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <cstdint>
+
+namespace jlizard::stats
+{
+    /**
+     * @brief Event counters of the library, see snapshot()
+     *
+     * Counted only in builds with BYTEAO_ENABLE_STATS=ON, every field stays zero otherwise.
+     */
+    struct Counters
+    {
+        std::uint64_t allocations = 0;      ///< heap blocks allocated by ByteStorage (ByteArray, ByteArrayBatch...)
+        std::uint64_t allocated_bytes = 0;  ///< total size of those blocks
+        std::uint64_t deallocations = 0;    ///< heap blocks returned
+        std::uint64_t reallocations = 0;    ///< growths that moved existing contents into a larger block
+        std::uint64_t copies = 0;           ///< deep copies of a byte sequence into a storage (copy construction, assignment)
+        std::uint64_t bytes_copied = 0;     ///< bytes copied by deep copies, appends and reallocations
+        std::uint64_t wipes = 0;            ///< secure erase operations (secure_wipe(), secure storage, SecureErase)
+        std::uint64_t bytes_wiped = 0;      ///< bytes securely erased
+        std::uint64_t verify_failures = 0;  ///< erasure verifications that found a non-zero byte
+
+        Counters& operator+=(const Counters& other) noexcept;
+        // field-wise difference, e.g. the cost of a workload between two snapshots
+        [[nodiscard]] Counters operator-(const Counters& other) const noexcept;
+        bool operator==(const Counters&) const = default;
+    };
+
+    // true if the library was built with BYTEAO_ENABLE_STATS=ON
+    [[nodiscard]] bool enabled() noexcept;
+
+    /**
+     * @brief Counters of the calling thread since it started (or since reset())
+     */
+    [[nodiscard]] Counters thread_snapshot() noexcept;
+
+    /**
+     * @brief Counters summed over all threads, including threads that have exited
+     *
+     * Every thread counts into its own block, so counting costs no synchronisation; this
+     * only reads the blocks. Counts of threads that are running concurrently may be a few
+     * events behind.
+     *
+     * @example
+     * const auto before = stats::snapshot();
+     * run_workload();
+     * const auto cost = stats::snapshot() - before;
+     * std::cout << cost.allocations << " allocations, " << cost.bytes_copied << " bytes copied\n";
+     */
+    [[nodiscard]] Counters snapshot() noexcept;
+
+    /**
+     * @brief Restarts the counts of every thread (and of exited threads) from zero
+     *
+     * The current counts are recorded as a baseline that snapshot() and thread_snapshot()
+     * subtract, so threads counting concurrently lose no events; an event racing with the
+     * reset lands on either side of it.
+     */
+    void reset() noexcept;
+}
+
+#endif //STATS_H
@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef XOR_STREAM_H
+#define XOR_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+
+#include "jlizard/byte_array.h"
+#include "jlizard/byte_view.h"
+
+namespace jlizard
+{
+    /**
+     * @class XorStream
+     * @brief Chunked XOR (or complement) of data that does not fit in memory
+     *
+     * Input is processed in chunks of any size through update(), the keystream position is
+     * carried over from one chunk to the next, so feeding a file in pieces produces exactly
+     * the bytes you would get by XORing it in one go. The keystream is either
+     * - a repeating key (repeating()),
+     * - produced block by block by a callback, e.g. a cipher in counter mode or a
+     *   random::ChaCha20Drbg (the KeystreamSource constructor), or
+     * - all ones, which turns the stream into a complement (complement()).
+     *
+     * Keystream is buffered `block_size` bytes at a time and every chunk goes through the
+     * same SIMD kernels as ByteArray's operator^ and operator~, so the throughput matches
+     * the in-memory path. Unlike operator^ there is no right alignment: byte i of the input
+     * is combined with byte i of the keystream.
+     *
+     * @example
+     * XorStream stream = XorStream::repeating(key);
+     * ByteArray out;
+     * while (auto chunk = socket.read()) {
+     *     stream.update(chunk, out);
+     *     file.write(out);
+     * }
+     * // or in one call for standard streams
+     * XorStream::repeating(key).process(input_file, output_file);
+     */
+    class XorStream
+    {
+    public:
+        // writes the next count keystream bytes to out
+        using KeystreamSource = std::function<void(unsigned char* out, size_t count)>;
+
+        static constexpr size_t default_block_size = 64 * 1024;
+
+        /**
+         * @brief Stream whose keystream is produced by source, block_size bytes per call
+         *
+         * @throws std::invalid_argument If source is empty or block_size is zero
+         */
+        explicit XorStream(KeystreamSource source, size_t block_size = default_block_size);
+
+        /**
+         * @brief Stream XORing with key repeated indefinitely, the key is copied
+         *
+         * @param key The key, at least one byte
+         * @param block_size Size of the expanded keystream buffer and of process()'s chunks,
+         *        rounded up to a multiple of the key size
+         * @throws std::invalid_argument If the key is empty or block_size is zero
+         */
+        static XorStream repeating(ByteView key, size_t block_size = default_block_size);
+
+        /**
+         * @brief Stream complementing its input (XOR with 0xFF), block_size only sets process()'s chunks
+         *
+         * @throws std::invalid_argument If block_size is zero
+         */
+        static XorStream complement(size_t block_size = default_block_size);
+
+        /**
+         * @brief Processes the next chunk into out, which gets in.size() bytes
+         *
+         * out's capacity is reused, and in may be out itself for in-place processing.
+         */
+        void update(ByteView in, ByteArray& out);
+        /**
+         * @brief Processes the next chunk into [out, out + in.size())
+         *
+         * out may be exactly in.data() (in place) but must not overlap the input otherwise.
+         */
+        void update(ByteView in, unsigned char* out);
+
+        /**
+         * @brief Processes a whole standard stream, block_size bytes at a time
+         *
+         * @return The number of bytes processed
+         * @throws std::runtime_error If writing to out fails
+         */
+        std::uint64_t process(std::istream& in, std::ostream& out);
+
+        // Number of bytes processed so far, i.e. the keystream position
+        [[nodiscard]] std::uint64_t position() const noexcept { return position_; }
+        [[nodiscard]] size_t block_size() const noexcept { return block_size_; }
+
+    private:
+        enum class EMode : std::uint8_t
+        {
+            GENERATED = 1,
+            REPEATING = 2,
+            COMPLEMENT = 3
+        };
+
+        XorStream(EMode mode, size_t block_size);
+        // provides a fresh buffer of keystream, keystream_pos_ is reset to 0
+        void refill_();
+
+        EMode mode_;
+        size_t block_size_;
+        KeystreamSource source_;
+        ByteArray keystream_;
+        size_t keystream_pos_ = 0;
+        std::uint64_t position_ = 0;
+    };
+}
+
+#endif //XOR_STREAM_H
@@ -27,49 +27,103 @@
 #include "jlizard/security_ops.h"
 #include "jlizard/byte_array_ops.h"
 
+#if !defined(JLBA_INLINE_HOT_PATHS)
+#include "jlizard/byte_array_inline.h"
+#endif
+
 #include <algorithm>
 #include <cstring>
-#include <iomanip>
-#include <iostream>
-#include <random>
 #include <stdexcept>
 
 using namespace jlizard;
 
-ByteArray::ByteArray(const std::string_view hex_str)
+namespace
 {
-    bytes_.resize(hex_str.length() / 2 + hex_str.length() % 2);
+    // true if the view points anywhere into the storage's current block
+    bool overlaps_storage(const ByteView view, const ByteStorage& storage) noexcept
+    {
+        if (view.empty()) return false;
+        const auto view_begin = reinterpret_cast<std::uintptr_t>(view.data());
+        const auto block_begin = reinterpret_cast<std::uintptr_t>(storage.data());
+        return view_begin < block_begin + storage.capacity() && block_begin < view_begin + view.size();
+    }
 
-    size_t output_index = 0;
+    // true if the view covers exactly the storage's contents
+    bool is_whole_storage(const ByteView view, const ByteStorage& storage) noexcept
+    {
+        return view.data() == storage.data() && view.size() == storage.size();
+    }
 
-    for (size_t i = 0; i < hex_str.size(); i += 2) {
-        char hex_byte[3] = {0};
+    using BitwiseOp = void (*)(ByteView, ByteView, ByteStorage&);
+    using BitwiseAssign = void (*)(ByteStorage&, ByteView);
 
-        if (i + 1 < hex_str.size()) {
-            hex_byte[0] = hex_str[i];
-            hex_byte[1] = hex_str[i+1];
-        } else {
-            hex_byte[0] = '0'; // Pad with 0
-            hex_byte[1] = hex_str[i];
+    // in place AND/OR/ANDNOT, an operand partially overlapping the target is copied first
+    void bitwise_assign(const BitwiseAssign assign, ByteStorage& inout, const ByteView operand)
+    {
+        if (overlaps_storage(operand, inout) && !is_whole_storage(operand, inout)) {
+            const ByteStorage copy(operand.data(), operand.size());
+            assign(inout, copy);
+            return;
+        }
+        assign(inout, operand);
+    }
+
+    // the *_into aliasing rules of xor_into
+    void bitwise_into(const BitwiseOp op, const BitwiseAssign assign, const ByteView a, const ByteView b,
+                      ByteStorage& out)
+    {
+        const bool a_aliases = overlaps_storage(a, out);
+        const bool b_aliases = overlaps_storage(b, out);
+        if (!a_aliases && !b_aliases) {
+            op(a, b, out);
+            return;
+        }
+        if (is_whole_storage(a, out) && b.size() <= a.size() && (!b_aliases || is_whole_storage(b, out))) {
+            assign(out, b);
+            return;
         }
 
-        char* end_ptr;
-        long value = strtol(hex_byte, &end_ptr, 16);
-        //FIXME document this function
+        ByteStorage result;
+        op(a, b, result);
+        out.assign(result.data(), result.size());
+    }
 
-        // Check for conversion errors
-        if (end_ptr == hex_byte || *end_ptr != '\0') {
-            throw std::runtime_error("Invalid hex character");
+    // shifts into out, evaluating aside when the input views part of out
+    void shift_into(void (*shift)(ByteView, size_t, ByteStorage&), void (*shift_assign)(ByteStorage&, size_t) noexcept,
+                    const ByteView input, const size_t bit_count, ByteStorage& out)
+    {
+        if (!overlaps_storage(input, out)) {
+            shift(input, bit_count, out);
+        } else if (is_whole_storage(input, out)) {
+            shift_assign(out, bit_count);
+        } else {
+            ByteStorage result;
+            shift(input, bit_count, result);
+            out.assign(result.data(), result.size());
         }
+    }
+}
 
-        bytes_[output_index++] = static_cast<unsigned char>(value);
+ByteArray::ByteArray(const std::string_view hex_str)
+{
+    bytes_.resize_uninitialized(hex_str.length() / 2 + hex_str.length() % 2);
+
+    // table driven decode straight into the pre-sized buffer
+    if (!ByteArrayOps::hex_decode(hex_str, bytes_.data())) {
+        throw std::runtime_error("Invalid hex character");
     }
 }
 
+ByteArray::ByteArray(std::vector<unsigned char>&& byte_array) : bytes_(byte_array.data(), byte_array.size())
+{
+    // the bytes now live in our own storage, don't leave a second copy behind
+    security::unsafe::SecureErase::secure_zero_vector(byte_array);
+}
+
 ByteArray::ByteArray(const ByteArray& other, const size_t num_bytes, const EZeroPadDir zero_pad_dir)
-    : bytes_(num_bytes, 0x00) {
+    : bytes_(num_bytes, 0x00), wipe_policy_(other.wipe_policy_) {
     // static cast to the difference type to avoid narrowing conversions
-    const auto copy_size = static_cast<std::vector<unsigned char>::difference_type>(std::min(other.size(), num_bytes));
+    const auto copy_size = static_cast<std::ptrdiff_t>(std::min(other.size(), num_bytes));
 
     if (EZeroPadDir::MSB_PAD == zero_pad_dir) {
         if (num_bytes > other.size()) {
@@ -87,85 +141,317 @@ ByteArray::ByteArray(const ByteArray& other, const size_t num_bytes, const EZero
 
 
 
+ByteArray::ByteArray(ByteArray&& other, const size_t num_bytes, const EZeroPadDir zero_pad_dir)
+    : bytes_(std::move(other.bytes_)), wipe_policy_(other.wipe_policy_)
+{
+    const size_t old_size = bytes_.size();
+    if (num_bytes < old_size) {
+        if (EZeroPadDir::MSB_PAD == zero_pad_dir) {
+            // keep the trailing num_bytes bytes
+            bytes_.erase_front(old_size - num_bytes);
+        } else {
+            bytes_.resize_uninitialized(num_bytes);
+        }
+        // the cut off bytes (or their stale copies after the shift) are still in the block
+        wipe_range_(bytes_.data() + num_bytes, old_size - num_bytes);
+    } else if (num_bytes > old_size) {
+        if (EZeroPadDir::MSB_PAD == zero_pad_dir) {
+            bytes_.insert_front(num_bytes - old_size, 0x00);
+        } else {
+            bytes_.resize(num_bytes, 0x00);
+        }
+    }
+}
+
 bool ByteArray::secure_wipe()
 {
-    const auto options = security::unsafe::SecureErase::Options(true);
-    return security::unsafe::SecureErase::secure_zero_vector(bytes_,options);
+    if (bytes_.is_secure() && !wipe_policy_.multi_pass) {
+        // the secure resource erases the heap block and the storage its inline buffer on release
+        bytes_.release();
+        return true;
+    }
+
+    const auto options = security::unsafe::SecureErase::Options(wipe_policy_.verify, true, wipe_policy_.multi_pass);
+    // erase the full capacity so bytes left behind by earlier shrinking are covered as well
+    const bool verified = security::unsafe::SecureErase::secure_zero_buffer(bytes_.data(), bytes_.capacity(), options);
+    bytes_.release();
+    return verified;
 }
 
-ByteArray& ByteArray::operator=(ByteArray&& other) noexcept
+ByteArray& ByteArray::operator=(ByteArray&& other)
 {
     if (this != &other) {
         bytes_ = std::move(other.bytes_);
+        wipe_policy_ = other.wipe_policy_;
     }
     return *this;
 }
 
-ByteArray ByteArray::operator^(const ByteArray& other) const
+
+ByteArray ByteArray::operator~() &&
 {
-    return ByteArray(ByteArrayOps::xor_op(this->bytes_, other.bytes_));
+    complement_into(*this, *this);
+    return std::move(*this);
 }
 
+ByteArray& ByteArray::xor_assign_(const ByteView other)
+{
+    // only the exact right-aligned tail (including the whole array) may be XORed in place,
+    // any other view into this array would be read after the kernel overwrote it
+    const bool is_tail = other.size() <= bytes_.size() && other.data() == bytes_.data() + (bytes_.size() - other.size());
+    if (!is_tail && overlaps_storage(other, bytes_)) {
+        const ByteStorage copy(other.data(), other.size());
+        ByteArrayOps::xor_assign(this->bytes_, copy);
+        return *this;
+    }
+    ByteArrayOps::xor_assign(this->bytes_, other);
+    return *this;
+}
 
-ByteArray ByteArray::operator^(unsigned char byte) const
+void ByteArray::xor_into(const ByteView a, const ByteView b, ByteArray& out)
 {
-    return ByteArray(ByteArrayOps::xor_op(this->bytes_,byte));
+    const bool a_aliases = overlaps_storage(a, out.bytes_);
+    const bool b_aliases = overlaps_storage(b, out.bytes_);
+
+    if (!a_aliases && !b_aliases) {
+        ByteArrayOps::xor_op(a, b, out.bytes_);
+        return;
+    }
+
+    // out ^= other, unless other partially overlaps out (the in-place kernel would read bytes it already wrote)
+    if (is_whole_storage(a, out.bytes_) && b.size() <= a.size() && (!b_aliases || is_whole_storage(b, out.bytes_))) {
+        ByteArrayOps::xor_assign(out.bytes_, b);
+        return;
+    }
+    if (is_whole_storage(b, out.bytes_) && a.size() <= b.size() && !a_aliases) {
+        ByteArrayOps::xor_assign(out.bytes_, a);
+        return;
+    }
+
+    const ByteStorage result = ByteArrayOps::xor_op(a, b);
+    out.bytes_.assign(result.data(), result.size());
 }
 
-ByteArray& ByteArray::operator^=(const ByteArray& other)
+void ByteArray::xor_into(const ByteView input, const unsigned char byte, ByteArray& out)
 {
-    const std::vector<unsigned char> temp_bytes = this->bytes_;
-    ByteArrayOps::xor_op(temp_bytes, other.bytes_, this->bytes_);
+    if (is_whole_storage(input, out.bytes_)) {
+        ByteArrayOps::xor_assign(out.bytes_, byte);
+        return;
+    }
+    if (overlaps_storage(input, out.bytes_)) {
+        const ByteStorage result = ByteArrayOps::xor_op(input, byte);
+        out.bytes_.assign(result.data(), result.size());
+        return;
+    }
 
+    ByteArrayOps::xor_op(input, byte, out.bytes_);
+}
+
+void ByteArray::complement_into(const ByteView input, ByteArray& out)
+{
+    // the complement kernel works element-wise, so exact aliasing is fine
+    if (!overlaps_storage(input, out.bytes_) || is_whole_storage(input, out.bytes_)) {
+        ByteArrayOps::complement(input, out.bytes_);
+        return;
+    }
+
+    const ByteStorage result = ByteArrayOps::complement(input);
+    out.bytes_.assign(result.data(), result.size());
+}
+
+ByteArray& ByteArray::operator&=(const ByteView other)
+{
+    bitwise_assign(ByteArrayOps::and_assign, bytes_, other);
     return *this;
 }
 
-ByteArray& ByteArray::operator^=(unsigned char byte)
+ByteArray& ByteArray::operator|=(const ByteView other)
 {
-    const std::vector<unsigned char> temp_bytes = this->bytes_;
-    ByteArrayOps::xor_op(temp_bytes, byte, bytes_);
+    bitwise_assign(ByteArrayOps::or_assign, bytes_, other);
     return *this;
 }
 
-ByteArray ByteArray::operator~() const {
-    // Create a new ByteArray by using the static complement function
-    ByteArray result;
-    result.bytes_ = ByteArrayOps::complement(this->bytes_);
-    return result;
+ByteArray& ByteArray::andnot_assign(const ByteView mask)
+{
+    bitwise_assign(ByteArrayOps::andnot_assign, bytes_, mask);
+    return *this;
 }
 
-bool ByteArray::operator==(const ByteArray& other) const
+ByteArray ByteArray::operator&(const ByteView other) const&
 {
-    if (size() != other.size()) return false;
+    ByteStorage result;
+    ByteArrayOps::and_op(*this, other, result);
+    return ByteArray(std::move(result));
+}
 
-    return std::ranges::equal(*this,other);
+ByteArray ByteArray::operator|(const ByteView other) const&
+{
+    ByteStorage result;
+    ByteArrayOps::or_op(*this, other, result);
+    return ByteArray(std::move(result));
 }
 
+ByteArray ByteArray::operator&(const ByteView other) &&
+{
+    *this &= other;
+    return std::move(*this);
+}
 
-uint64_t ByteArray::as_64bit_uint() const
+ByteArray ByteArray::operator|(const ByteView other) &&
 {
-    if (bytes_.size() > 8)
-    {
-        throw std::invalid_argument("Byte array is larger than 64-bit and cannot be represented as such");
+    *this |= other;
+    return std::move(*this);
+}
+
+void ByteArray::and_into(const ByteView a, const ByteView b, ByteArray& out)
+{
+    bitwise_into(ByteArrayOps::and_op, ByteArrayOps::and_assign, a, b, out.bytes_);
+}
+
+void ByteArray::or_into(const ByteView a, const ByteView b, ByteArray& out)
+{
+    bitwise_into(ByteArrayOps::or_op, ByteArrayOps::or_assign, a, b, out.bytes_);
+}
+
+void ByteArray::andnot_into(const ByteView a, const ByteView b, ByteArray& out)
+{
+    bitwise_into(ByteArrayOps::andnot_op, ByteArrayOps::andnot_assign, a, b, out.bytes_);
+}
+
+ByteArray& ByteArray::operator<<=(const size_t bit_count) noexcept
+{
+    ByteArrayOps::shift_left_assign(bytes_, bit_count);
+    return *this;
+}
+
+ByteArray& ByteArray::operator>>=(const size_t bit_count) noexcept
+{
+    ByteArrayOps::shift_right_assign(bytes_, bit_count);
+    return *this;
+}
+
+ByteArray ByteArray::operator<<(const size_t bit_count) const&
+{
+    ByteStorage result;
+    ByteArrayOps::shift_left(*this, bit_count, result);
+    return ByteArray(std::move(result));
+}
+
+ByteArray ByteArray::operator>>(const size_t bit_count) const&
+{
+    ByteStorage result;
+    ByteArrayOps::shift_right(*this, bit_count, result);
+    return ByteArray(std::move(result));
+}
+
+ByteArray ByteArray::operator<<(const size_t bit_count) &&
+{
+    *this <<= bit_count;
+    return std::move(*this);
+}
+
+ByteArray ByteArray::operator>>(const size_t bit_count) &&
+{
+    *this >>= bit_count;
+    return std::move(*this);
+}
+
+void ByteArray::shift_left_into(const ByteView input, const size_t bit_count, ByteArray& out)
+{
+    shift_into(ByteArrayOps::shift_left, ByteArrayOps::shift_left_assign, input, bit_count, out.bytes_);
+}
+
+void ByteArray::shift_right_into(const ByteView input, const size_t bit_count, ByteArray& out)
+{
+    shift_into(ByteArrayOps::shift_right, ByteArrayOps::shift_right_assign, input, bit_count, out.bytes_);
+}
+
+ByteArray& ByteArray::rotate_left(const size_t bit_count) noexcept
+{
+    ByteArrayOps::rotate_left_assign(bytes_, bit_count);
+    return *this;
+}
+
+ByteArray& ByteArray::rotate_right(const size_t bit_count) noexcept
+{
+    ByteArrayOps::rotate_right_assign(bytes_, bit_count);
+    return *this;
+}
+
+void ByteArray::xor_batch(const std::span<const ByteView> a, const std::span<const ByteView> b, const std::span<ByteArray> out)
+{
+    if (a.size() != b.size() || a.size() != out.size()) {
+        throw std::invalid_argument("Batch operands and outputs must have the same length");
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        xor_into(a[i], b[i], out[i]);
     }
+}
 
-    return ByteArrayOps::bytearray_to_uint64(bytes_);
+void ByteArray::xor_batch(const std::span<const ByteView> a, const ByteView key, const std::span<ByteArray> out)
+{
+    if (a.size() != out.size()) {
+        throw std::invalid_argument("Batch operands and outputs must have the same length");
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        xor_into(a[i], key, out[i]);
+    }
 }
 
-std::string ByteArray::as_hex_string() const {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (const auto byte : *this) {
-        ss << std::setw(2) << static_cast<int>(byte);
+void ByteArray::concat_into(const std::initializer_list<ByteView> parts, ByteArray& out)
+{
+    size_t total_size = 0;
+    bool aliases = false;
+    for (const auto& part : parts) {
+        total_size += part.size();
+        aliases = aliases || overlaps_storage(part, out.bytes_);
+    }
+
+    if (aliases) {
+        // a part views out itself, assemble aside so it is not overwritten before it is copied
+        ByteArray result = create_with_prealloc(total_size);
+        concat_into(parts, result);
+        out.bytes_.assign(result.bytes_.data(), result.bytes_.size());
+        return;
+    }
+
+    out.bytes_.clear();
+    out.bytes_.reserve(total_size);
+    for (const auto& part : parts) {
+        out.bytes_.append(part.data(), part.size());
     }
-    return ss.str();
+}
+
+
+
+
+
+std::string ByteArray::as_hex_string() const {
+    return ByteView(*this).as_hex_string();
+}
+
+void ByteArray::append_hex_to(std::string& out) const
+{
+    ByteView(*this).append_hex_to(out);
+}
+
+std::to_chars_result ByteArray::to_hex_chars(char* first, char* last) const noexcept
+{
+    return ByteView(*this).to_hex_chars(first, last);
 }
 
 ByteArray ByteArray::create_with_prealloc(size_t reserve_size)
 {
-    std::vector<unsigned char> buf;
-    buf.reserve(reserve_size);
-    return ByteArray(std::move(buf));
+    ByteArray result;
+    result.bytes_.reserve(reserve_size);
+    return result;
+}
+
+ByteArray ByteArray::create_with_prealloc(size_t reserve_size, const allocator_type& alloc)
+{
+    ByteArray result(alloc);
+    result.bytes_.reserve(reserve_size);
+    return result;
 }
 
 ByteArray ByteArray::create_from_uint64(const uint64_t byte_array_long)
@@ -192,29 +478,71 @@ ByteArray ByteArray::create_from_string(std::string_view sv)
 
 ByteArray ByteArray::concat_and_create(const std::initializer_list<ByteArray>& arrays)
 {
-    ByteArray result;
+    size_t total_size = 0;
+    for (const auto& array : arrays) {
+        total_size += array.size();
+    }
+
+    // sized up front so the parts are copied exactly once
+    ByteArray result = create_with_prealloc(total_size);
     for (const auto& array : arrays) {
-        result.bytes_.insert(result.bytes_.end(), array.bytes_.begin(), array.bytes_.end());
+        result.bytes_.append(array.bytes_.data(), array.bytes_.size());
     }
     return result;
 
 }
 
-ByteArray& ByteArray::concat(const ByteArray& other)
+ByteArray& ByteArray::concat(const ByteView other)
+{
+    bytes_.append(other.data(), other.size());
+    return *this;
+}
+
+ByteArray& ByteArray::append(const void* data, const size_t size)
 {
-    bytes_.insert(bytes_.end(), other.bytes_.begin(), other.bytes_.end());
+    bytes_.append(static_cast<const unsigned char*>(data), size);
     return *this;
 }
 
-ByteArray ByteArray::concat_copy(const ByteArray& other) const
+ByteArray& ByteArray::insert(const size_t pos, const ByteView other)
 {
-    ByteArray result(*this);
+    if (pos > bytes_.size()) {
+        throw std::out_of_range("ByteArray::insert position out of range");
+    }
+    if (other.empty()) return *this;
+
+    if (overlaps_storage(other, bytes_)) {
+        // the source would be shifted (or reallocated) under us, insert a copy of it
+        const ByteArray copy(other);
+        return insert(pos, copy);
+    }
+
+    const size_t old_size = bytes_.size();
+    const size_t count = other.size();
+    bytes_.resize_uninitialized(old_size + count);
+    unsigned char* base = bytes_.data();
+    if (pos < old_size) std::memmove(base + pos + count, base + pos, old_size - pos);
+    std::memcpy(base + pos, other.data(), count);
+    return *this;
+}
+
+ByteArray ByteArray::concat_copy(const ByteView other) const&
+{
+    ByteArray result = create_with_prealloc(size() + other.size());
+    result.wipe_policy_ = wipe_policy_;
+    result.bytes_.append(bytes_.data(), bytes_.size());
     result.concat(other);
 
     return result;
 }
 
-ByteArray ByteArray::create_from_prng(const size_t num_bytes)
+ByteArray ByteArray::concat_copy(const ByteView other) &&
+{
+    concat(other);
+    return std::move(*this);
+}
+
+ByteArray ByteArray::create_from_prng(const size_t num_bytes, const ERandomSource source)
 {
 
     // Check if requested size exceeds the limit
@@ -222,32 +550,70 @@ ByteArray ByteArray::create_from_prng(const size_t num_bytes)
         throw std::invalid_argument("Requested random bytes exceed maximum allowed size (1 MB)");
     }
 
-    std::random_device rd;  // True random source
-    std::uniform_int_distribution<unsigned int> dist(0, 255);  // Range for a byte
-
-    std::vector<unsigned char> random_bytes(num_bytes);
-    for (size_t i = 0; i < num_bytes; ++i) {
-        random_bytes[i] = static_cast<unsigned char>(dist(rd));
-    }
+    ByteStorage random_bytes;
+    random_bytes.resize_uninitialized(num_bytes);
+    random::fill(random_bytes.data(), num_bytes, source);
 
     return ByteArray(std::move(random_bytes));
 }
 
+void ByteArray::fill_random(ByteArray& target, const ERandomSource source)
+{
+    random::fill(target.bytes_.data(), target.bytes_.size(), source);
+}
+
 
-void ByteArray::resize(const size_t new_size,const bool purge_before_resize,const bool output_warning,const EZeroPadDir zero_pad_dir)
+void ByteArray::resize(const size_t new_size,const bool purge_before_resize,[[maybe_unused]] const bool output_warning,const EZeroPadDir zero_pad_dir)
 {
+    const size_t old_size = size();
+    if (new_size == old_size) return;
+
+    if (new_size < old_size) {
+        // if we are shrinking then we need to secure wipe the truncated bytes to avoid data remnance
+        const size_t removed = old_size - new_size;
+        if (zero_pad_dir == EZeroPadDir::MSB_PAD) {
+            bytes_.erase_front(removed);
+        } else {
+            bytes_.resize_uninitialized(new_size);
+        }
+        // erase_front moved the kept bytes over the removed ones, the stale tail is past the new size either way
+        if (purge_before_resize) wipe_range_(bytes_.data() + new_size, removed);
+        return;
+    }
 
-    // if we are shrinking then we need to secure wipe the old byte array to avoid data remnance
-    if (purge_before_resize && output_warning && (new_size < size())) std::cerr << "SECURITY WARNING : attempting to shrink a byte array buffer this could lead to data remnance" << std::endl;
+    if (new_size > bytes_.capacity() && (purge_before_resize || zero_pad_dir == EZeroPadDir::MSB_PAD)) {
+        grow_into_new_block_(new_size, zero_pad_dir, purge_before_resize);
+        return;
+    }
 
-    ByteArray temp(*this,new_size,zero_pad_dir);
-    if (purge_before_resize)
-    {
-        secure_wipe();
+    if (zero_pad_dir == EZeroPadDir::MSB_PAD) {
+        bytes_.insert_front(new_size - old_size, 0x00);
+    } else {
+        bytes_.resize(new_size, 0x00);
     }
+}
 
-    *this = std::move(temp);
+bool ByteArray::wipe_range_(unsigned char* first, const size_t count)
+{
+    const auto options = security::unsafe::SecureErase::Options(wipe_policy_.verify, true, wipe_policy_.multi_pass);
+    return security::unsafe::SecureErase::secure_zero_buffer(first, count, options);
+}
 
+void ByteArray::grow_into_new_block_(const size_t new_size, const EZeroPadDir zero_pad_dir, const bool purge)
+{
+    const size_t old_size = size();
+    const size_t padding = new_size - old_size;
+
+    ByteStorage grown(bytes_.resource());
+    grown.reserve(new_size);
+    grown.resize_uninitialized(new_size);
+    const size_t data_offset = zero_pad_dir == EZeroPadDir::MSB_PAD ? padding : 0;
+    std::memset(grown.data() + (data_offset == 0 ? old_size : 0), 0x00, padding);
+    if (old_size > 0) std::memcpy(grown.data() + data_offset, bytes_.data(), old_size);
+
+    if (purge) secure_wipe();
+    // same resource, so the block is adopted without copying
+    bytes_ = std::move(grown);
 }
 
 void ByteArray::resize(const size_t new_size, const EZeroPadDir zero_pad_dir, bool purge_before_resize, bool output_warning)
@@ -257,8 +623,8 @@ void ByteArray::resize(const size_t new_size, const EZeroPadDir zero_pad_dir, bo
 
 void ByteArray::clear(const bool bsecure_purge)
 {
-    if (bsecure_purge) secure_wipe();
-    *this = ByteArray();
+    if (bsecure_purge) wipe_range_(bytes_.data(), bytes_.capacity());
+    bytes_.clear();
 }
 
 
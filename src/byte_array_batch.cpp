@@ -0,0 +1,173 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_array_batch.h"
+#include "jlizard/parallel_ops.h"
+#include "jlizard/secure_memory_resource.h"
+#include "jlizard/security_ops.h"
+#include "jlizard/simd_kernels.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+using namespace jlizard;
+
+namespace
+{
+    // the key is repeated to about this many bytes so each kernel call covers several records
+    constexpr size_t kKeyPatternBytes = 4096;
+
+    // bytes taken by count records, a product that does not fit size_t would silently shrink the batch
+    size_t block_bytes(const size_t count, const size_t record_size)
+    {
+        if (count > std::numeric_limits<size_t>::max() / record_size) {
+            throw std::length_error("ByteArrayBatch record count times record size overflows");
+        }
+        return count * record_size;
+    }
+
+    void check_same_shape(const ByteArrayBatch& a, const ByteArrayBatch& b)
+    {
+        if (a.record_size() != b.record_size()) {
+            throw std::invalid_argument("Batches have different record sizes");
+        }
+        if (a.size() != b.size()) {
+            throw std::invalid_argument("Batches have different record counts");
+        }
+    }
+}
+
+ByteArrayBatch::ByteArrayBatch(const size_t record_size, const size_t count, const allocator_type& alloc)
+    : bytes_(alloc.resource()), record_size_(record_size)
+{
+    if (record_size == 0) throw std::invalid_argument("Record size must not be zero");
+    bytes_.resize(block_bytes(count, record_size), 0x00);
+}
+
+ByteView ByteArrayBatch::at(const size_t index) const
+{
+    if (index >= size()) throw std::out_of_range("ByteArrayBatch index out of range");
+    return (*this)[index];
+}
+
+void ByteArrayBatch::reserve(const size_t count)
+{
+    bytes_.reserve(block_bytes(count, record_size_));
+}
+
+void ByteArrayBatch::resize(const size_t count)
+{
+    bytes_.resize(block_bytes(count, record_size_), 0x00);
+}
+
+void ByteArrayBatch::push_back(const ByteView record)
+{
+    if (record.size() != record_size_) {
+        throw std::invalid_argument("Record size does not match the batch record size");
+    }
+    // append copes with a record viewing this batch, it copies before reallocating
+    bytes_.append(record.data(), record.size());
+}
+
+void ByteArrayBatch::xor_into(const ByteArrayBatch& a, const ByteArrayBatch& b, ByteArrayBatch& out)
+{
+    check_same_shape(a, b);
+    out.record_size_ = a.record_size_;
+    out.bytes_.resize_uninitialized(a.bytes_.size());
+    // the records are contiguous in all three batches, so this is a single kernel pass
+    parallel::xor_bytes(a.data(), b.data(), out.data(), a.bytes_.size());
+}
+
+void ByteArrayBatch::xor_into(const ByteArrayBatch& a, const ByteView key, ByteArrayBatch& out)
+{
+    const size_t record_size = a.record_size_;
+    if (key.size() != record_size) {
+        throw std::invalid_argument("Key size does not match the batch record size");
+    }
+
+    // one record more than the stripe, so a stripe can start at any phase of the key
+    const size_t stripe_records = std::max<size_t>(1, kKeyPatternBytes / record_size);
+    // the pattern repeats key material, the secure resource erases it when it is released
+    ByteStorage pattern((stripe_records + 1) * record_size, 0x00, secure_resource());
+    for (size_t offset = 0; offset < pattern.size(); offset += record_size) {
+        std::memcpy(pattern.data() + offset, key.data(), record_size);
+    }
+
+    const size_t total = a.bytes_.size();
+    out.record_size_ = record_size;
+    out.bytes_.resize_uninitialized(total);
+
+    const unsigned char* in = a.data();
+    unsigned char* dst = out.data();
+    const auto& kernels = simd::active();
+    parallel::for_each_chunk(total, [&](const size_t begin, const size_t end) {
+        for (size_t pos = begin; pos < end;) {
+            const size_t phase = pos % record_size;
+            const size_t take = std::min(end - pos, pattern.size() - phase);
+            kernels.xor_bytes(in + pos, pattern.data() + phase, dst + pos, take);
+            pos += take;
+        }
+    });
+}
+
+void ByteArrayBatch::complement_into(const ByteArrayBatch& a, ByteArrayBatch& out)
+{
+    out.record_size_ = a.record_size_;
+    out.bytes_.resize_uninitialized(a.bytes_.size());
+    parallel::complement_bytes(a.data(), out.data(), a.bytes_.size());
+}
+
+ByteArrayBatch& ByteArrayBatch::operator^=(const ByteArrayBatch& other)
+{
+    xor_into(*this, other, *this);
+    return *this;
+}
+
+ByteArrayBatch& ByteArrayBatch::operator^=(const ByteView key)
+{
+    xor_into(*this, key, *this);
+    return *this;
+}
+
+bool ByteArrayBatch::operator==(const ByteArrayBatch& other) const noexcept
+{
+    return record_size_ == other.record_size_ && view() == other.view();
+}
+
+bool ByteArrayBatch::secure_wipe()
+{
+    if (bytes_.is_secure()) {
+        // the secure resource erases the heap block and the storage its inline buffer on release
+        bytes_.release();
+        return true;
+    }
+
+    const auto options = security::unsafe::SecureErase::Options(true);
+    const bool verified = security::unsafe::SecureErase::secure_zero_buffer(bytes_.data(), bytes_.capacity(), options);
+    bytes_.release();
+    return verified;
+}
@@ -24,8 +24,11 @@
  */
  
  #include "jlizard/byte_array_ops.h"
+ #include "jlizard/parallel_ops.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
 #include <cstring>
 #include <stdexcept>
@@ -33,6 +36,87 @@
 
 using namespace jlizard;
 
+namespace
+{
+    constexpr unsigned char kInvalidNibble = 0xFF;
+
+    // maps every ASCII character to its nibble value or kInvalidNibble
+    constexpr std::array<unsigned char, 256> make_hex_decode_table()
+    {
+        std::array<unsigned char, 256> table{};
+        table.fill(kInvalidNibble);
+        for (unsigned char c = 0; c < 10; ++c) table['0' + c] = c;
+        for (unsigned char c = 0; c < 6; ++c) {
+            table['a' + c] = 10 + c;
+            table['A' + c] = 10 + c;
+        }
+        return table;
+    }
+
+    // maps every byte value to its two lowercase hex characters
+    constexpr std::array<char, 512> make_hex_encode_table()
+    {
+        constexpr char digits[] = "0123456789abcdef";
+        std::array<char, 512> table{};
+        for (size_t i = 0; i < 256; ++i) {
+            table[2 * i] = digits[i >> 4];
+            table[2 * i + 1] = digits[i & 0x0F];
+        }
+        return table;
+    }
+
+    constexpr auto kHexDecodeTable = make_hex_decode_table();
+    constexpr auto kHexEncodeTable = make_hex_encode_table();
+
+    enum class EBitwiseOp { AND, OR, ANDNOT };
+
+    void bitwise_bytes(const EBitwiseOp op, const unsigned char* a, const unsigned char* b, unsigned char* out,
+                       const size_t len)
+    {
+        switch (op) {
+            case EBitwiseOp::AND: parallel::and_bytes(a, b, out, len); break;
+            case EBitwiseOp::OR: parallel::bitor_bytes(a, b, out, len); break;
+            case EBitwiseOp::ANDNOT: parallel::andnot_bytes(a, b, out, len); break;
+        }
+    }
+
+    // Right-aligned like xor_op: the result prefix in front of the overlap is the longer operand combined
+    // with zero padding, which is the operand itself for OR (and ANDNOT with a longer first operand) and
+    // zero otherwise. Every result byte is written exactly once
+    void bitwise_op(const EBitwiseOp op, const ByteView first, const ByteView second, ByteStorage& result_out)
+    {
+        const size_t result_size = std::max(first.size(), second.size());
+        const size_t overlap = std::min(first.size(), second.size());
+        const size_t prefix_size = result_size - overlap;
+        result_out.resize_uninitialized(result_size);
+
+        const bool first_is_longer = first.size() >= second.size();
+        if (prefix_size > 0) {
+            const bool keep_prefix = op == EBitwiseOp::OR || (op == EBitwiseOp::ANDNOT && first_is_longer);
+            if (keep_prefix) {
+                std::memcpy(result_out.data(), first_is_longer ? first.data() : second.data(), prefix_size);
+            } else {
+                std::memset(result_out.data(), 0, prefix_size);
+            }
+        }
+        bitwise_bytes(op, first.data() + (first.size() - overlap), second.data() + (second.size() - overlap),
+                      result_out.data() + prefix_size, overlap);
+    }
+
+    void bitwise_assign(const EBitwiseOp op, ByteStorage& inout, const ByteView operand)
+    {
+        if (inout.size() < operand.size()) {
+            // the zero prefix combined with the operand's leading bytes gives the right result for every op
+            inout.insert_front(operand.size() - inout.size(), 0x00);
+        }
+
+        const size_t offset = inout.size() - operand.size();
+        // x & 0 is zero, x | 0 and x & ~0 leave the prefix untouched
+        if (op == EBitwiseOp::AND && offset > 0) std::memset(inout.data(), 0, offset);
+        bitwise_bytes(op, inout.data() + offset, operand.data(), inout.data() + offset, operand.size());
+    }
+}
+
 //FIXME document right-alignment procedure
 //FIXME document RVO
 
@@ -42,9 +126,7 @@ void ByteArrayOps::Unsafe::complement(const unsigned char* in, unsigned char* ou
     if (!out) return;
     if (!in) return;
 
-    for(size_t i=0;i<length;++i) {
-        out[i] = ~in[i];
-    }
+    parallel::complement_bytes(in, out, length);
 
     //FIXME move this to tests section
     for(size_t i=0;i<length;++i) {
@@ -52,62 +134,76 @@ void ByteArrayOps::Unsafe::complement(const unsigned char* in, unsigned char* ou
     }
 }
 
-void ByteArrayOps::complement(const std::vector<unsigned char>& in, std::vector<unsigned char>& out)
+void ByteArrayOps::complement(const ByteView in, ByteStorage& out)
 {
     if (in.empty())
     {
         throw std::invalid_argument("Cannot process an empty byte array");
     }
 
-    out.resize(in.size());
+    // every byte is overwritten below, skip the zero fill
+    out.resize_uninitialized(in.size());
 
-    for (size_t i = 0; i < in.size(); ++i)
-    {
-        out[i] = ~in[i];
-    }
+    parallel::complement_bytes(in.data(), out.data(), in.size());
 
 }
 
-std::vector<unsigned char> ByteArrayOps::complement(const std::vector<unsigned char>& in)
+ByteStorage ByteArrayOps::complement(const ByteView in)
 {
-    std::vector<unsigned char> ret;
+    ByteStorage ret;
     complement(in,ret);
     return ret;
 }
 
 
-void ByteArrayOps::xor_op(const std::vector<unsigned char>& first_operand, const std::vector<unsigned char>& second_operand, std::vector<unsigned char>& result_out)
+void ByteArrayOps::xor_op(const ByteView first_operand, const ByteView second_operand, ByteStorage& result_out)
 {
     const size_t arr_size = std::max(first_operand.size(), second_operand.size());
-    result_out.resize(arr_size);
 
-    // Fill result with zeros initially FIXME document std::ranges
-    std::fill(result_out.begin(), result_out.end(), 0);
+    // no zero fill, every result byte is written exactly once by the fused kernel below
+    result_out.resize_uninitialized(arr_size);
 
-    // XOR the overlapping parts (from the right)
-    const size_t first_offset = arr_size - first_operand.size();
-    const size_t second_offset = arr_size - second_operand.size();
+    Unsafe::xor_op(first_operand.data(), first_operand.size(),
+                   second_operand.data(), second_operand.size(),
+                   result_out.data(), result_out.size());
+}
 
-    for (size_t i = 0; i < first_operand.size(); i++) {
-        result_out[first_offset + i] ^= first_operand[i];
-    }
+void ByteArrayOps::xor_op(const ByteView input, unsigned char byte, ByteStorage& result_out)
+{
+    // an empty input still yields the single byte, as if XORed against {byte}
+    result_out.resize_uninitialized(std::max<size_t>(input.size(), 1));
 
-    for (size_t i = 0; i < second_operand.size(); i++) {
-        result_out[second_offset + i] ^= second_operand[i];
-    }
+    Unsafe::xor_op(input.data(), input.size(), byte, result_out.data(), result_out.size());
 }
 
-void ByteArrayOps::xor_op(const std::vector<unsigned char>& input, unsigned char byte, std::vector<unsigned char>& result_out)
+
+
+void ByteArrayOps::xor_assign(ByteStorage& inout, const ByteView operand)
 {
-    const std::vector<unsigned char> byte_buf(1,byte);
-    xor_op(input,byte_buf,result_out);
+    if (inout.size() < operand.size()) {
+        // Growth path: left-pad with zeros so both operands are right-aligned, the
+        // padded prefix then simply receives the operand's leading bytes
+        inout.insert_front(operand.size() - inout.size(), 0x00);
+    }
+
+    // single pass over the overlapping (rightmost) region, also safe for self XOR
+    const size_t offset = inout.size() - operand.size();
+    parallel::xor_bytes(inout.data() + offset, operand.data(), inout.data() + offset, operand.size());
 }
 
+void ByteArrayOps::xor_assign(ByteStorage& inout, const unsigned char byte)
+{
+    if (inout.empty()) {
+        inout.push_back(byte);
+        return;
+    }
 
+    inout.back() ^= byte;
+}
 
-std::vector<unsigned char> ByteArrayOps::xor_op(const std::vector<unsigned char>& first_operand, const std::vector<unsigned char>& second_operand)
+ByteStorage ByteArrayOps::xor_op(const ByteView first_operand, const ByteView second_operand)
 {
-    std::vector<unsigned char> result;
+    ByteStorage result;
     xor_op(first_operand,second_operand,result);
     return result;
 }
@@ -117,27 +213,25 @@ void ByteArrayOps::Unsafe::xor_op(const unsigned char* first, size_t first_size,
                                   unsigned char* result, size_t result_size)
 {
     // Ensure result buffer is large enough
-    size_t required_size = std::max(first_size, second_size);
+    const size_t required_size = std::max(first_size, second_size);
     if (result_size < required_size) {
         return;
     }
 
-    // Zero out the result buffer
-    std::memset(result, 0, result_size);
+    // Right-alignment: the shorter operand is implicitly zero-padded on the left, so the
+    // prefix of the result is just the longer operand's prefix and only the overlap needs XOR
+    const bool first_is_longer = first_size >= second_size;
+    const unsigned char* longer = first_is_longer ? first : second;
+    const unsigned char* shorter = first_is_longer ? second : first;
+    const size_t shorter_size = first_is_longer ? second_size : first_size;
+    const size_t prefix_size = required_size - shorter_size;
 
-    // Apply right-alignment logic and XOR
-    size_t first_offset = required_size - first_size;
-    size_t second_offset = required_size - second_size;
+    // Fused single pass: every result byte is written exactly once
+    if (prefix_size > 0) std::memcpy(result, longer, prefix_size);
+    parallel::xor_bytes(longer + prefix_size, shorter, result + prefix_size, shorter_size);
 
-    // First copy the first operand (without XOR since buffer is zeroed)
-    for (size_t i = 0; i < first_size; i++) {
-        result[first_offset + i] = first[i];
-    }
-
-    // Then XOR the second operand in-place
-    for (size_t i = 0; i < second_size; i++) {
-        result[second_offset + i] ^= second[i];
-    }
+    // Bytes past the XOR result are zeroed
+    if (result_size > required_size) std::memset(result + required_size, 0, result_size - required_size);
 }
 
 void ByteArrayOps::Unsafe::xor_op(const unsigned char* input, size_t input_size,
@@ -145,73 +239,213 @@ void ByteArrayOps::Unsafe::xor_op(const unsigned char* input, size_t input_size,
                                  unsigned char* result, size_t result_size)
 {
     // Make sure result buffer has enough space
-    if (result_size < input_size) {
+    if (result_size < input_size || result_size == 0) {
         return;
     }
 
-    // Zero out the result buffer
-    std::memset(result, 0, result_size);
-
-    // Apply right-alignment logic
-    size_t input_offset = result_size - input_size;
+    // Apply right-alignment logic, only the padding in front of the input is zeroed
+    const size_t input_offset = result_size - input_size;
+    if (input_offset > 0) std::memset(result, 0, input_offset);
 
     // Copy input data to result (starting at the proper offset)
-    for (size_t i = 0; i < input_size; i++) {
-        result[input_offset + i] = input[i];
-    }
+    if (input_size > 0) std::memcpy(result + input_offset, input, input_size);
 
     // XOR the last byte with the provided byte value
     result[result_size - 1] ^= byte;
 }
 
-std::vector<unsigned char> ByteArrayOps::xor_op(const std::vector<unsigned char>& input, unsigned char byte)
+ByteStorage ByteArrayOps::xor_op(const ByteView input, unsigned char byte)
 {
-    std::vector<unsigned char> result;
+    ByteStorage result;
     xor_op(input,byte,result);
     return result;
 }
 
 
-void ByteArrayOps::uint64_to_bytearray(const uint64_t in, std::vector<unsigned char>& out)
+void ByteArrayOps::and_op(const ByteView first_operand, const ByteView second_operand, ByteStorage& result_out)
+{
+    bitwise_op(EBitwiseOp::AND, first_operand, second_operand, result_out);
+}
+
+void ByteArrayOps::or_op(const ByteView first_operand, const ByteView second_operand, ByteStorage& result_out)
+{
+    bitwise_op(EBitwiseOp::OR, first_operand, second_operand, result_out);
+}
+
+void ByteArrayOps::andnot_op(const ByteView first_operand, const ByteView second_operand, ByteStorage& result_out)
+{
+    bitwise_op(EBitwiseOp::ANDNOT, first_operand, second_operand, result_out);
+}
+
+void ByteArrayOps::and_assign(ByteStorage& inout, const ByteView operand)
+{
+    bitwise_assign(EBitwiseOp::AND, inout, operand);
+}
+
+void ByteArrayOps::or_assign(ByteStorage& inout, const ByteView operand)
+{
+    bitwise_assign(EBitwiseOp::OR, inout, operand);
+}
+
+void ByteArrayOps::andnot_assign(ByteStorage& inout, const ByteView operand)
+{
+    bitwise_assign(EBitwiseOp::ANDNOT, inout, operand);
+}
+
+void ByteArrayOps::shift_left(const ByteView in, const size_t bit_count, ByteStorage& out)
+{
+    const size_t size = in.size();
+    out.resize_uninitialized(size);
+    const size_t byte_shift = std::min(bit_count / 8, size);
+    const auto bits = static_cast<unsigned>(bit_count % 8);
+    const size_t kept = size - byte_shift;
+
+    if (kept > 0 && bits == 0) std::memcpy(out.data(), in.data() + byte_shift, kept);
+    if (kept > 0 && bits != 0) parallel::shl_bits(in.data() + byte_shift, out.data(), kept, bits, 0x00);
+    if (byte_shift > 0) std::memset(out.data() + kept, 0, byte_shift);
+}
+
+void ByteArrayOps::shift_right(const ByteView in, const size_t bit_count, ByteStorage& out)
+{
+    const size_t size = in.size();
+    out.resize_uninitialized(size);
+    const size_t byte_shift = std::min(bit_count / 8, size);
+    const auto bits = static_cast<unsigned>(bit_count % 8);
+    const size_t kept = size - byte_shift;
+
+    if (kept > 0 && bits == 0) std::memcpy(out.data() + byte_shift, in.data(), kept);
+    if (kept > 0 && bits != 0) parallel::shr_bits(in.data(), out.data() + byte_shift, kept, bits, 0x00);
+    if (byte_shift > 0) std::memset(out.data(), 0, byte_shift);
+}
+
+void ByteArrayOps::shift_left_assign(ByteStorage& inout, const size_t bit_count) noexcept
 {
-    // Convert to big-endian byte order (most significant byte first)
-    uint64_t value = in;
-    // Count how many bytes we need
-    int bytes_needed = 0;
-    uint64_t temp = value;
-    do {
-        bytes_needed++;
-        temp >>= 8;
-    } while (temp != 0);
+    const size_t size = inout.size();
+    const size_t byte_shift = std::min(bit_count / 8, size);
+    const auto bits = static_cast<unsigned>(bit_count % 8);
+    const size_t kept = size - byte_shift;
+    unsigned char* data = inout.data();
+
+    // the kernel runs front to back, so its output may start before its input
+    if (kept > 0 && bits == 0 && byte_shift > 0) std::memmove(data, data + byte_shift, kept);
+    if (kept > 0 && bits != 0) parallel::shl_bits(data + byte_shift, data, kept, bits, 0x00);
+    if (byte_shift > 0) std::memset(data + kept, 0, byte_shift);
+}
 
-    // Resize the output vector
-    out.resize(bytes_needed);
+void ByteArrayOps::shift_right_assign(ByteStorage& inout, const size_t bit_count) noexcept
+{
+    const size_t size = inout.size();
+    const size_t byte_shift = std::min(bit_count / 8, size);
+    const auto bits = static_cast<unsigned>(bit_count % 8);
+    const size_t kept = size - byte_shift;
+    unsigned char* data = inout.data();
+
+    // the kernel runs back to front, so its output may start after its input
+    if (kept > 0 && bits == 0 && byte_shift > 0) std::memmove(data + byte_shift, data, kept);
+    if (kept > 0 && bits != 0) parallel::shr_bits(data, data + byte_shift, kept, bits, 0x00);
+    if (byte_shift > 0) std::memset(data, 0, byte_shift);
+}
 
-    // Fill the vector with bytes in big-endian order
-    for (int i = bytes_needed - 1; i >= 0; i--) {
-        out[bytes_needed - 1 - i] = static_cast<unsigned char>((value >> (i * 8)) & 0xFF);
+void ByteArrayOps::rotate_left_assign(ByteStorage& inout, const size_t bit_count) noexcept
+{
+    const size_t size = inout.size();
+    if (size == 0) return;
+    const size_t rotation = bit_count % (size * 8);
+    const auto bits = static_cast<unsigned>(rotation % 8);
+
+    std::rotate(inout.begin(), inout.begin() + rotation / 8, inout.end());
+    if (bits != 0) {
+        // the last byte takes its low bits from the first one, which is overwritten before it is reached
+        const unsigned char first = inout[0];
+        parallel::shl_bits(inout.data(), inout.data(), size, bits, first);
     }
 }
 
-uint64_t ByteArrayOps::bytearray_to_uint64(const std::vector<unsigned char>& in)
+void ByteArrayOps::rotate_right_assign(ByteStorage& inout, const size_t bit_count) noexcept
 {
-    if (in.size() > 8) {
-        throw std::invalid_argument("Byte array is larger than 64-bit and cannot be represented as such");
+    const size_t size = inout.size();
+    if (size == 0) return;
+    const size_t rotation = bit_count % (size * 8);
+    const auto bits = static_cast<unsigned>(rotation % 8);
+
+    std::rotate(inout.begin(), inout.end() - rotation / 8, inout.end());
+    if (bits != 0) {
+        const unsigned char last = inout.back();
+        parallel::shr_bits(inout.data(), inout.data(), size, bits, last);
     }
+}
 
-    uint64_t result = 0;
+uint64_t ByteArrayOps::popcount(const ByteView in) noexcept
+{
+    return parallel::popcount_bytes(in.data(), in.size());
+}
 
-    // Convert from big-endian byte order
-    for (size_t i = 0; i < in.size(); i++) {
-        result = (result << 8) | in[i];
-    }
+uint64_t ByteArrayOps::hamming_distance(const ByteView first_operand, const ByteView second_operand) noexcept
+{
+    const bool first_is_longer = first_operand.size() >= second_operand.size();
+    const ByteView longer = first_is_longer ? first_operand : second_operand;
+    const ByteView shorter = first_is_longer ? second_operand : first_operand;
+    const size_t prefix_size = longer.size() - shorter.size();
+
+    // the implicit zero padding of the shorter operand differs from every set bit of the longer one's prefix
+    return parallel::popcount_bytes(longer.data(), prefix_size) +
+           parallel::hamming_bytes(longer.data() + prefix_size, shorter.data(), shorter.size());
+}
 
-    return result;
+void ByteArrayOps::uint64_to_bytearray(const uint64_t in, ByteStorage& out)
+{
+    // minimal big-endian width, zero still takes one byte
+    const size_t bytes_needed = in == 0 ? 1 : sizeof(uint64_t) - static_cast<size_t>(std::countl_zero(in)) / 8;
+
+    // one byte swapped word, of which the trailing bytes_needed bytes are the value
+    const auto word = byte_order::to_bytes<EByteOrder::MSB_FIRST>(in);
+    out.assign(word.data() + sizeof(uint64_t) - bytes_needed, bytes_needed);
 }
 
+uint64_t ByteArrayOps::bytearray_to_uint64(const ByteView in)
+{
+    if (in.size() > 8) {
+        throw std::invalid_argument("Byte array is larger than 64-bit and cannot be represented as such");
+    }
 
+    // big-endian, right-aligned in a zeroed word
+    return byte_order::load<uint64_t, EByteOrder::MSB_FIRST>(in.data(), in.size());
+}
 
+void ByteArrayOps::hex_encode(const unsigned char* in, const size_t length, char* out) noexcept
+{
+    for (size_t i = 0; i < length; ++i) {
+        const char* pair = &kHexEncodeTable[static_cast<size_t>(in[i]) * 2];
+        out[2 * i] = pair[0];
+        out[2 * i + 1] = pair[1];
+    }
+}
 
+bool ByteArrayOps::hex_decode(const std::string_view hex, unsigned char* out) noexcept
+{
+    // accumulate invalid flags instead of branching per character so the loop stays tight
+    unsigned char invalid = 0;
+    const size_t pairs = hex.size() / 2;
+
+    for (size_t i = 0; i < pairs; ++i) {
+        const unsigned char high = kHexDecodeTable[static_cast<unsigned char>(hex[2 * i])];
+        const unsigned char low = kHexDecodeTable[static_cast<unsigned char>(hex[2 * i + 1])];
+        invalid |= (high | low) & 0xF0;
+        out[i] = static_cast<unsigned char>((high << 4) | (low & 0x0F));
+    }
 
+    if (hex.size() % 2 != 0) {
+        // odd length : the trailing character is decoded as if it were prefixed with a 0
+        const unsigned char low = kHexDecodeTable[static_cast<unsigned char>(hex.back())];
+        invalid |= low & 0xF0;
+        out[pairs] = low & 0x0F;
+    }
 
+    return invalid == 0;
+}
 
+bool ByteArrayOps::secure_equals(const ByteView first_operand, const ByteView second_operand) noexcept
+{
+    if (first_operand.size() != second_operand.size()) return false;
+    return parallel::diff_bytes(first_operand.data(), second_operand.data(), first_operand.size()) == 0;
+}
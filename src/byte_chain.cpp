@@ -0,0 +1,273 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_chain.h"
+#include "jlizard/parallel_ops.h"
+#include "jlizard/shared_byte_array.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#if defined(JLBA_HAS_WRITEV)
+#include <climits>
+#include <sys/uio.h>
+#endif
+
+using namespace jlizard;
+
+namespace
+{
+    // frames are usually a handful of parts, start with room for them to avoid regrowing
+    constexpr size_t kInitialSegments = 4;
+}
+
+ByteChain& ByteChain::append(const ByteView bytes)
+{
+    if (!bytes.empty()) {
+        if (segments_.capacity() == 0) segments_.reserve(kInitialSegments);
+        segments_.push_back({bytes, nullptr});
+        size_ += bytes.size();
+    }
+    return *this;
+}
+
+ByteChain& ByteChain::append(ByteArray&& bytes)
+{
+    return append(std::make_shared<const ByteArray>(std::move(bytes)));
+}
+
+ByteChain& ByteChain::append(std::shared_ptr<const ByteArray> bytes)
+{
+    if (bytes && !bytes->empty()) {
+        const ByteView view(*bytes);
+        if (segments_.capacity() == 0) segments_.reserve(kInitialSegments);
+        segments_.push_back({view, std::move(bytes)});
+        size_ += view.size();
+    }
+    return *this;
+}
+
+ByteChain& ByteChain::append(const SharedByteArray& bytes)
+{
+    if (!bytes.empty()) {
+        const ByteView view = bytes.view();
+        if (segments_.capacity() == 0) segments_.reserve(kInitialSegments);
+        segments_.push_back({view, bytes.block_});
+        size_ += view.size();
+    }
+    return *this;
+}
+
+ByteChain& ByteChain::append(const ByteChain& other)
+{
+    if (&other == this) {
+        // appending to ourselves would invalidate the range being copied
+        const std::vector<Segment> copy = segments_;
+        segments_.insert(segments_.end(), copy.begin(), copy.end());
+        size_ *= 2;
+        return *this;
+    }
+    segments_.insert(segments_.end(), other.segments_.begin(), other.segments_.end());
+    size_ += other.size_;
+    return *this;
+}
+
+ByteView ByteChain::segment(const size_t index) const noexcept
+{
+    JLBA_ASSERT(index < segments_.size(), "ByteChain segment index out of range");
+    return segments_[index].view;
+}
+
+unsigned char ByteChain::at(size_t index) const
+{
+    if (index >= size_) throw std::out_of_range("ByteChain index out of range");
+    for (const auto& segment : segments_) {
+        if (index < segment.view.size()) return segment.view[index];
+        index -= segment.view.size();
+    }
+    // unreachable, size_ is the sum of the segment sizes
+    throw std::out_of_range("ByteChain index out of range");
+}
+
+void ByteChain::clear() noexcept
+{
+    segments_.clear();
+    size_ = 0;
+}
+
+ByteArray ByteChain::flatten() const
+{
+    ByteArray result = ByteArray::create_with_prealloc(size_);
+    flatten_into(result);
+    return result;
+}
+
+void ByteChain::flatten_into(ByteArray& out) const
+{
+    if (aliases_(out, ByteView())) {
+        // a segment views out itself, assemble aside so it is not overwritten before it is copied
+        ByteArray result(out.get_allocator());
+        flatten_into(result);
+        out = std::move(result);
+        return;
+    }
+
+    out.bytes_.resize_uninitialized(size_);
+    unsigned char* dst = out.bytes_.data();
+    for (const auto& segment : segments_) {
+        std::memcpy(dst, segment.view.data(), segment.view.size());
+        dst += segment.view.size();
+    }
+}
+
+void ByteChain::xor_into(const ByteView other, ByteArray& out) const
+{
+    if (aliases_(out, other)) {
+        ByteArray result(out.get_allocator());
+        xor_into(other, result);
+        out = std::move(result);
+        return;
+    }
+
+    // right alignment, the shorter side is padded with leading zeros
+    const size_t result_size = std::max(size_, other.size());
+    const size_t chain_offset = result_size - size_;
+    const size_t other_offset = result_size - other.size();
+
+    out.bytes_.resize_uninitialized(result_size);
+    unsigned char* dst = out.bytes_.data();
+    // bytes in front of the chain come from other's prefix (only when other is longer)
+    if (chain_offset > 0) std::memcpy(dst, other.data(), chain_offset);
+
+    size_t pos = chain_offset;
+    for (const auto& segment : segments_) {
+        const unsigned char* src = segment.view.data();
+        size_t remaining = segment.view.size();
+        // part of the segment in front of other (only when the chain is longer) is copied
+        if (pos < other_offset) {
+            const size_t copied = std::min(remaining, other_offset - pos);
+            std::memcpy(dst + pos, src, copied);
+            pos += copied;
+            src += copied;
+            remaining -= copied;
+        }
+        if (remaining > 0) {
+            parallel::xor_bytes(src, other.data() + (pos - other_offset), dst + pos, remaining);
+            pos += remaining;
+        }
+    }
+}
+
+void ByteChain::complement_into(ByteArray& out) const
+{
+    if (empty()) {
+        throw std::invalid_argument("Cannot process an empty byte array");
+    }
+    if (aliases_(out, ByteView())) {
+        ByteArray result(out.get_allocator());
+        complement_into(result);
+        out = std::move(result);
+        return;
+    }
+
+    out.bytes_.resize_uninitialized(size_);
+    unsigned char* dst = out.bytes_.data();
+    for (const auto& segment : segments_) {
+        parallel::complement_bytes(segment.view.data(), dst, segment.view.size());
+        dst += segment.view.size();
+    }
+}
+
+bool ByteChain::equals(const ByteView view) const noexcept
+{
+    if (view.size() != size_) return false;
+    size_t pos = 0;
+    for (const auto& segment : segments_) {
+        if (std::memcmp(segment.view.data(), view.data() + pos, segment.view.size()) != 0) return false;
+        pos += segment.view.size();
+    }
+    return true;
+}
+
+bool ByteChain::aliases_(const ByteArray& out, const ByteView extra) const noexcept
+{
+    const auto block_begin = reinterpret_cast<std::uintptr_t>(out.data());
+    const auto block_end = block_begin + out.capacity();
+    const auto overlaps = [&](const ByteView view) {
+        if (view.empty()) return false;
+        const auto view_begin = reinterpret_cast<std::uintptr_t>(view.data());
+        return view_begin < block_end && block_begin < view_begin + view.size();
+    };
+
+    if (overlaps(extra)) return true;
+    return std::any_of(segments_.begin(), segments_.end(),
+                       [&](const Segment& segment) { return overlaps(segment.view); });
+}
+
+#if defined(JLBA_HAS_WRITEV)
+size_t ByteChain::write_to(const int fd) const
+{
+#if defined(IOV_MAX)
+    constexpr size_t max_batch = IOV_MAX;
+#else
+    constexpr size_t max_batch = 1024;
+#endif
+
+    std::vector<iovec> iov;
+    iov.reserve(segments_.size());
+    for (const auto& segment : segments_) {
+        // writev never writes through iov_base, the cast only satisfies its signature
+        iov.push_back({const_cast<unsigned char*>(segment.view.data()), segment.view.size()});
+    }
+
+    size_t first = 0;
+    size_t written = 0;
+    while (first < iov.size()) {
+        const auto batch = static_cast<int>(std::min(iov.size() - first, max_batch));
+        const ssize_t result = ::writev(fd, iov.data() + first, batch);
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            throw std::system_error(errno, std::generic_category(), "writev failed");
+        }
+
+        // skip the fully written entries and trim a partially written one
+        auto remaining = static_cast<size_t>(result);
+        written += remaining;
+        while (first < iov.size() && remaining >= iov[first].iov_len) {
+            remaining -= iov[first].iov_len;
+            ++first;
+        }
+        if (remaining > 0) {
+            iov[first].iov_base = static_cast<unsigned char*>(iov[first].iov_base) + remaining;
+            iov[first].iov_len -= remaining;
+        }
+    }
+    return written;
+}
+#endif
@@ -0,0 +1,59 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_reader.h"
+
+#include <stdexcept>
+#include <string>
+
+using namespace jlizard;
+
+void ByteReader::throw_underrun_(const size_t count) const
+{
+    throw std::out_of_range("ByteReader: read of " + std::to_string(count) + " bytes at offset " +
+                            std::to_string(position_) + " exceeds the " + std::to_string(remaining()) +
+                            " remaining bytes");
+}
+
+void ByteReader::throw_prefixed_underrun_(const size_t prefix_size, const std::uint64_t length,
+                                          const bool saturated) const
+{
+    throw std::out_of_range("ByteReader: length prefixed read of " + std::to_string(prefix_size) + " + " +
+                            (saturated ? "more than " : "") + std::to_string(length) + " bytes at offset " +
+                            std::to_string(position_) + " exceeds the " + std::to_string(remaining()) +
+                            " remaining bytes");
+}
+
+void ByteReader::throw_width_(const size_t width, const size_t max_width)
+{
+    throw std::invalid_argument("ByteReader: field width " + std::to_string(width) + " exceeds the " +
+                                std::to_string(max_width) + " byte target type");
+}
+
+void ByteReader::throw_seek_(const size_t position) const
+{
+    throw std::out_of_range("ByteReader: seek to " + std::to_string(position) + " is past the end of the " +
+                            std::to_string(input_.size()) + " byte input");
+}
@@ -0,0 +1,276 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_storage.h"
+#include "jlizard/secure_memory_resource.h"
+#include "jlizard/security_ops.h"
+#include "jlizard/stats_counters.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+using namespace jlizard;
+
+ByteStorage::ByteStorage(std::pmr::memory_resource* resource) noexcept
+    : data_(inline_), resource_(resource),
+      secure_(dynamic_cast<const SecureMemoryResource*>(resource) != nullptr)
+{
+}
+
+ByteStorage::ByteStorage(const size_t count, const unsigned char value, std::pmr::memory_resource* resource)
+    : ByteStorage(resource)
+{
+    resize(count, value);
+}
+
+ByteStorage::ByteStorage(const unsigned char* first, const size_t count, std::pmr::memory_resource* resource)
+    : ByteStorage(resource)
+{
+    assign(first, count);
+}
+
+ByteStorage::ByteStorage(const ByteStorage& other) : ByteStorage()
+{
+    assign(other.data_, other.size_);
+}
+
+ByteStorage::ByteStorage(const ByteStorage& other, std::pmr::memory_resource* resource) : ByteStorage(resource)
+{
+    assign(other.data_, other.size_);
+}
+
+ByteStorage::ByteStorage(ByteStorage&& other) noexcept
+    : data_(inline_), resource_(other.resource_), secure_(other.secure_)
+{
+    // same resource, so steal_ always adopts and never allocates
+    steal_(other);
+}
+
+ByteStorage& ByteStorage::operator=(const ByteStorage& other)
+{
+    if (this != &other) {
+        assign(other.data_, other.size_);
+    }
+    return *this;
+}
+
+ByteStorage& ByteStorage::operator=(ByteStorage&& other)
+{
+    if (this != &other) {
+        release();
+        steal_(other);
+    }
+    return *this;
+}
+
+ByteStorage::~ByteStorage()
+{
+    release();
+}
+
+void ByteStorage::reserve(const size_t new_capacity)
+{
+    if (new_capacity > capacity_) {
+        reallocate_(new_capacity);
+    }
+}
+
+void ByteStorage::resize(const size_t new_size, const unsigned char value)
+{
+    const size_t old_size = size_;
+    resize_uninitialized(new_size);
+    if (new_size > old_size) {
+        std::memset(data_ + old_size, value, new_size - old_size);
+    }
+}
+
+void ByteStorage::resize_uninitialized(const size_t new_size)
+{
+    if (new_size > capacity_) {
+        reallocate_(grown_capacity_(new_size));
+    }
+    size_ = new_size;
+}
+
+void ByteStorage::assign(const unsigned char* first, const size_t count)
+{
+    if (count > capacity_) {
+        // nothing to preserve, drop the contents before growing to avoid copying them
+        size_ = 0;
+        reallocate_(count);
+    }
+    if (count > 0) std::memmove(data_, first, count);
+    size_ = count;
+    JLBA_STAT_ADD(copies, 1);
+    JLBA_STAT_ADD(bytes_copied, count);
+}
+
+void ByteStorage::append(const unsigned char* first, const size_t count)
+{
+    if (count == 0) return;
+
+    if (size_ + count > capacity_) {
+        // first may point into our own block, so copy everything before the old block goes away
+        const size_t new_capacity = grown_capacity_(size_ + count);
+        unsigned char* block = allocate_(new_capacity);
+        if (size_ > 0) std::memcpy(block, data_, size_);
+        std::memcpy(block + size_, first, count);
+        if (size_ > 0) JLBA_STAT_ADD(reallocations, 1);
+        JLBA_STAT_ADD(bytes_copied, size_ + count);
+
+        const size_t new_size = size_ + count;
+        release();
+        data_ = block;
+        capacity_ = new_capacity;
+        size_ = new_size;
+        return;
+    }
+
+    std::memcpy(data_ + size_, first, count);
+    size_ += count;
+    JLBA_STAT_ADD(bytes_copied, count);
+}
+
+void ByteStorage::push_back(const unsigned char byte)
+{
+    if (size_ == capacity_) {
+        reallocate_(grown_capacity_(size_ + 1));
+    }
+    data_[size_++] = byte;
+}
+
+void ByteStorage::insert_front(const size_t count, const unsigned char value)
+{
+    if (count == 0) return;
+
+    const size_t old_size = size_;
+    resize_uninitialized(old_size + count);
+    if (old_size > 0) std::memmove(data_ + count, data_, old_size);
+    std::memset(data_, value, count);
+}
+
+void ByteStorage::erase_front(const size_t count) noexcept
+{
+    const size_t removed = std::min(count, size_);
+    if (removed < size_) std::memmove(data_, data_ + removed, size_ - removed);
+    size_ -= removed;
+}
+
+void ByteStorage::release() noexcept
+{
+    if (!is_inline()) {
+        deallocate_(data_, capacity_);
+        data_ = inline_;
+        capacity_ = inline_capacity;
+    } else {
+        wipe_inline_();
+    }
+    size_ = 0;
+}
+
+void ByteStorage::swap(ByteStorage& other)
+{
+    if (this == &other) return;
+
+    if (!is_inline() && !other.is_inline() && resource_->is_equal(*other.resource_)) {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        return;
+    }
+
+    // at least one side lives inline, go through a temporary so the pointers get fixed up
+    ByteStorage temp(std::move(other));
+    other.steal_(*this);
+    steal_(temp);
+}
+
+void ByteStorage::steal_(ByteStorage& other)
+{
+    if (other.is_inline()) {
+        if (other.size_ > 0) std::memcpy(inline_, other.inline_, other.size_);
+        size_ = other.size_;
+        other.wipe_inline_();
+    } else if (!resource_->is_equal(*other.resource_)) {
+        // the block belongs to another resource and must be returned there
+        assign(other.data_, other.size_);
+        other.release();
+        return;
+    } else {
+        // take over the heap block
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.data_ = other.inline_;
+        other.capacity_ = inline_capacity;
+    }
+    other.size_ = 0;
+}
+
+void ByteStorage::reallocate_(const size_t new_capacity)
+{
+    if (new_capacity <= inline_capacity && is_inline()) return;
+
+    unsigned char* block = allocate_(new_capacity);
+    const size_t old_size = size_;
+    if (old_size > 0) {
+        std::memcpy(block, data_, old_size);
+        JLBA_STAT_ADD(reallocations, 1);
+        JLBA_STAT_ADD(bytes_copied, old_size);
+    }
+
+    release();
+    data_ = block;
+    capacity_ = new_capacity;
+    size_ = old_size;
+}
+
+size_t ByteStorage::grown_capacity_(const size_t required) const noexcept
+{
+    // geometric growth keeps repeated appends amortised O(1)
+    return std::max(required, capacity_ * 2);
+}
+
+unsigned char* ByteStorage::allocate_(const size_t bytes)
+{
+    auto* block = static_cast<unsigned char*>(resource_->allocate(bytes, alignof(std::max_align_t)));
+    JLBA_STAT_ADD(allocations, 1);
+    JLBA_STAT_ADD(allocated_bytes, bytes);
+    return block;
+}
+
+void ByteStorage::deallocate_(unsigned char* block, const size_t bytes) noexcept
+{
+    resource_->deallocate(block, bytes, alignof(std::max_align_t));
+    JLBA_STAT_ADD(deallocations, 1);
+}
+
+void ByteStorage::wipe_inline_() noexcept
+{
+    if (secure_) {
+        security::unsafe::SecureErase::secure_zero_buffer(inline_, inline_capacity, security::unsafe::SecureErase::Options());
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_view.h"
+#include "jlizard/byte_array_ops.h"
+#include "jlizard/parallel_ops.h"
+
+#if !defined(JLBA_INLINE_HOT_PATHS)
+#include "jlizard/byte_view_inline.h"
+#endif
+
+using namespace jlizard;
+
+bool detail::equal_bytes(const unsigned char* a, const unsigned char* b, const size_t len) noexcept
+{
+    return parallel::equal_bytes(a, b, len);
+}
+
+std::string ByteView::as_hex_string() const
+{
+    std::string hex;
+    append_hex_to(hex);
+    return hex;
+}
+
+void ByteView::append_hex_to(std::string& out) const
+{
+    const size_t offset = out.size();
+    out.resize(offset + size() * 2);
+    ByteArrayOps::hex_encode(data(), size(), out.data() + offset);
+}
+
+std::to_chars_result ByteView::to_hex_chars(char* first, char* last) const noexcept
+{
+    const size_t required = size() * 2;
+    if (static_cast<size_t>(last - first) < required) {
+        return {last, std::errc::value_too_large};
+    }
+
+    ByteArrayOps::hex_encode(data(), size(), first);
+    return {first + required, std::errc{}};
+}
+
+bool jlizard::secure_equals(const ByteView a, const ByteView b) noexcept
+{
+    return ByteArrayOps::secure_equals(a, b);
+}
+
+uint64_t jlizard::popcount(const ByteView bytes) noexcept
+{
+    return ByteArrayOps::popcount(bytes);
+}
+
+uint64_t jlizard::hamming_distance(const ByteView a, const ByteView b) noexcept
+{
+    return ByteArrayOps::hamming_distance(a, b);
+}
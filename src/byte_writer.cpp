@@ -0,0 +1,65 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/byte_writer.h"
+
+#include <algorithm>
+
+using namespace jlizard;
+
+ByteWriter& ByteWriter::fill(const size_t count, const unsigned char value)
+{
+    if (count > remaining()) grow_(count);
+    if (count > 0) std::memset(cursor_, value, count);
+    cursor_ += count;
+    return *this;
+}
+
+void ByteWriter::grow_(const size_t extra)
+{
+    // reserve() only carries over size() bytes, publish everything written so far first
+    flush();
+    ByteStorage& storage = target_.bytes_;
+    const size_t used = storage.size();
+    storage.reserve(std::max(used + extra, storage.capacity() * 2));
+
+    begin_ = storage.data();
+    cursor_ = begin_ + used;
+    end_ = begin_ + storage.capacity();
+}
+
+void ByteWriter::write_slow_(const unsigned char* data, const size_t size)
+{
+    if (data >= begin_ && data < end_) {
+        // the source lives in the block that is about to be reallocated
+        const ByteArray copy(ByteView(data, size));
+        grow_(size);
+        std::memcpy(cursor_, copy.data(), size);
+    } else {
+        grow_(size);
+        std::memcpy(cursor_, data, size);
+    }
+    cursor_ += size;
+}
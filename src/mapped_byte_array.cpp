@@ -0,0 +1,198 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/mapped_byte_array.h"
+#include "jlizard/byte_array.h"
+#include "jlizard/security_ops.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace jlizard;
+
+namespace
+{
+#if defined(_WIN32)
+    [[noreturn]] void throw_last_error(const char* what)
+    {
+        throw std::system_error(static_cast<int>(::GetLastError()), std::system_category(), what);
+    }
+
+    // closes a handle when the mapping has been created or the constructor throws
+    struct HandleGuard
+    {
+        HANDLE handle;
+        ~HandleGuard() { if (handle != nullptr && handle != INVALID_HANDLE_VALUE) ::CloseHandle(handle); }
+    };
+
+    unsigned char* map_view(const std::filesystem::path& path, const EMapMode mode, size_t& size)
+    {
+        const HandleGuard file{::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                             FILE_ATTRIBUTE_NORMAL, nullptr)};
+        if (file.handle == INVALID_HANDLE_VALUE) throw_last_error("Cannot open file for mapping");
+
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file.handle, &file_size)) throw_last_error("Cannot determine the size of the mapped file");
+        if (static_cast<std::uint64_t>(file_size.QuadPart) > SIZE_MAX) {
+            throw std::system_error(std::make_error_code(std::errc::file_too_large), "File too large to map");
+        }
+        size = static_cast<size_t>(file_size.QuadPart);
+        if (size == 0) return nullptr;
+
+        const bool writable = mode == EMapMode::COPY_ON_WRITE;
+        const HandleGuard mapping{::CreateFileMappingW(file.handle, nullptr, writable ? PAGE_WRITECOPY : PAGE_READONLY,
+                                                       0, 0, nullptr)};
+        if (mapping.handle == nullptr) throw_last_error("CreateFileMapping failed");
+
+        // the view keeps the mapping and the file alive, both handles can be closed
+        void* view = ::MapViewOfFile(mapping.handle, writable ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) throw_last_error("MapViewOfFile failed");
+        return static_cast<unsigned char*>(view);
+    }
+
+    void unmap_view(unsigned char* data, size_t) noexcept
+    {
+        ::UnmapViewOfFile(data);
+    }
+#else
+    [[noreturn]] void throw_errno(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    unsigned char* map_view(const std::filesystem::path& path, const EMapMode mode, size_t& size)
+    {
+        int fd;
+        do {
+            fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        } while (fd < 0 && errno == EINTR);
+        if (fd < 0) throw_errno("Cannot open file for mapping");
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "Cannot determine the size of the mapped file");
+        }
+        if (static_cast<std::uintmax_t>(info.st_size) > SIZE_MAX) {
+            ::close(fd);
+            throw std::system_error(std::make_error_code(std::errc::file_too_large), "File too large to map");
+        }
+        size = static_cast<size_t>(info.st_size);
+        if (size == 0) {
+            ::close(fd);
+            return nullptr;
+        }
+
+        // private in both modes, so writes through a copy-on-write mapping never reach the file
+        const int protection = mode == EMapMode::COPY_ON_WRITE ? PROT_READ | PROT_WRITE : PROT_READ;
+        void* view = ::mmap(nullptr, size, protection, MAP_PRIVATE, fd, 0);
+        const int error = errno;
+        // the mapping holds its own reference to the file
+        ::close(fd);
+        if (view == MAP_FAILED) throw std::system_error(error, std::generic_category(), "mmap failed");
+        return static_cast<unsigned char*>(view);
+    }
+
+    void unmap_view(unsigned char* data, const size_t size) noexcept
+    {
+        ::munmap(data, size);
+    }
+#endif
+}
+
+MappedByteArray::MappedByteArray(const std::filesystem::path& path, const EMapMode mode) : mode_(mode)
+{
+    if (mode != EMapMode::READ_ONLY && mode != EMapMode::COPY_ON_WRITE) {
+        throw std::invalid_argument("Unknown map mode");
+    }
+    data_ = map_view(path, mode, size_);
+}
+
+MappedByteArray::MappedByteArray(MappedByteArray&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)), mode_(other.mode_)
+{
+}
+
+MappedByteArray& MappedByteArray::operator=(MappedByteArray&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mode_ = other.mode_;
+    }
+    return *this;
+}
+
+MappedByteArray::~MappedByteArray()
+{
+    reset();
+}
+
+unsigned char* MappedByteArray::mutable_data()
+{
+    if (!is_writable()) throw std::logic_error("MappedByteArray is mapped read-only");
+    return data_;
+}
+
+ByteArray MappedByteArray::to_byte_array() const
+{
+    return ByteArray(view());
+}
+
+bool MappedByteArray::secure_wipe()
+{
+    if (data_ == nullptr) return true;
+    if (!is_writable()) {
+        throw std::logic_error("A read-only mapping shares its pages with the page cache and cannot be wiped");
+    }
+
+    const auto options = security::unsafe::SecureErase::Options(true);
+    const bool verified = security::unsafe::SecureErase::secure_zero_buffer(data_, size_, options);
+    reset();
+    return verified;
+}
+
+void MappedByteArray::reset() noexcept
+{
+    if (data_ != nullptr) {
+        unmap_view(data_, size_);
+        data_ = nullptr;
+    }
+    size_ = 0;
+}
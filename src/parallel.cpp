@@ -0,0 +1,390 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/parallel.h"
+#include "jlizard/parallel_ops.h"
+#include "jlizard/simd_kernels.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+#if !defined(BYTEAO_DISABLE_PARALLEL)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+#endif
+
+using namespace jlizard;
+
+namespace
+{
+    std::atomic<size_t> g_threshold{parallel::Config{}.threshold};
+    std::atomic<size_t> g_chunk_size{parallel::Config{}.chunk_size};
+    std::atomic<unsigned> g_max_threads{parallel::Config{}.max_threads};
+
+#if !defined(BYTEAO_DISABLE_PARALLEL)
+    unsigned hardware_threads() noexcept
+    {
+        static const unsigned count = std::max(1u, std::thread::hardware_concurrency());
+        return count;
+    }
+
+    /**
+     * Persistent workers that help the submitting thread with one job at a time.
+     *
+     * A job is a range cut into chunks; every participant claims the next unclaimed chunk
+     * until none are left, so uneven progress balances itself. The submitter withdraws the
+     * job once its own loop ends and waits for the workers still finishing a chunk, after
+     * that no worker can touch the job any more.
+     */
+    class WorkerPool
+    {
+    public:
+        struct Job
+        {
+            const std::function<void(size_t, size_t)>* body;
+            size_t len;
+            size_t chunk;
+            size_t chunks;
+            unsigned max_helpers;
+            std::atomic<size_t> next{0};
+            std::atomic<unsigned> helpers{0};
+        };
+
+        static WorkerPool& instance()
+        {
+            static WorkerPool pool;
+            return pool;
+        }
+
+        // false if another job is running or the pool was inherited through fork()
+        bool run(Job& job)
+        {
+            if (!owned_by_this_process_()) return false;
+            std::unique_lock submit(submit_, std::try_to_lock);
+            if (!submit.owns_lock()) return false;
+
+            // workers are started on demand and kept for the lifetime of the process
+            while (workers_.size() < job.max_helpers) {
+                workers_.emplace_back([this] { worker_loop_(); });
+            }
+
+            {
+                std::lock_guard lock(mutex_);
+                job_ = &job;
+                ++generation_;
+            }
+            wake_.notify_all();
+
+            work_(job);
+
+            std::unique_lock lock(mutex_);
+            job_ = nullptr;
+            idle_.wait(lock, [this] { return active_ == 0; });
+            return true;
+        }
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+    private:
+        WorkerPool()
+        {
+#if !defined(_WIN32)
+            owner_pid_ = ::getpid();
+#endif
+        }
+
+        ~WorkerPool()
+        {
+            {
+                std::lock_guard lock(mutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (auto& worker : workers_) {
+                if (worker.joinable()) worker.join();
+            }
+        }
+
+        static void work_(Job& job) noexcept
+        {
+            for (size_t index = job.next.fetch_add(1, std::memory_order_relaxed); index < job.chunks;
+                 index = job.next.fetch_add(1, std::memory_order_relaxed)) {
+                const size_t begin = index * job.chunk;
+                (*job.body)(begin, std::min(job.len, begin + job.chunk));
+            }
+        }
+
+        void worker_loop_()
+        {
+            std::uint64_t seen = 0;
+            std::unique_lock lock(mutex_);
+            for (;;) {
+                wake_.wait(lock, [&] { return stop_ || (job_ != nullptr && generation_ != seen); });
+                if (stop_) return;
+                seen = generation_;
+
+                Job* job = job_;
+                if (job->helpers.fetch_add(1, std::memory_order_relaxed) >= job->max_helpers) continue;
+                ++active_;
+                lock.unlock();
+                work_(*job);
+                lock.lock();
+                if (--active_ == 0) idle_.notify_all();
+            }
+        }
+
+        bool owned_by_this_process_() const noexcept
+        {
+#if defined(_WIN32)
+            return true;
+#else
+            // the worker threads do not survive fork(), a child has to stay single threaded
+            return ::getpid() == owner_pid_;
+#endif
+        }
+
+        std::mutex submit_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable idle_;
+        std::vector<std::thread> workers_;
+        Job* job_ = nullptr;
+        std::uint64_t generation_ = 0;
+        unsigned active_ = 0;
+        bool stop_ = false;
+#if !defined(_WIN32)
+        pid_t owner_pid_ = 0;
+#endif
+    };
+
+    // runs body over [0, len) on the pool, false if the caller has to do it alone
+    bool run_parallel(const size_t len, const std::function<void(size_t, size_t)>& body) noexcept
+    {
+        if (len < g_threshold.load(std::memory_order_relaxed)) return false;
+        const unsigned threads = parallel::thread_count();
+        if (threads < 2) return false;
+
+        const size_t chunk = g_chunk_size.load(std::memory_order_relaxed);
+        WorkerPool::Job job{&body, len, chunk, (len + chunk - 1) / chunk, threads - 1};
+        if (job.chunks < 2) return false;
+        try {
+            return WorkerPool::instance().run(job);
+        } catch (...) {
+            // a worker could not be started, fall back to one thread
+            return false;
+        }
+    }
+#endif
+
+    using BinaryKernel = void (*)(const unsigned char*, const unsigned char*, unsigned char*, size_t);
+
+    // the element-wise two operand kernels, dispatched like xor_bytes
+    void run_binary(const BinaryKernel kernel, const unsigned char* a, const unsigned char* b, unsigned char* out,
+                    const size_t len) noexcept
+    {
+        if (len < g_threshold.load(std::memory_order_relaxed)) {
+            kernel(a, b, out, len);
+            return;
+        }
+        parallel::for_each_chunk(len, [&](const size_t begin, const size_t end) {
+            kernel(a + begin, b + begin, out + begin, end - begin);
+        });
+    }
+
+    bool overlaps(const unsigned char* in, const unsigned char* out, const size_t len) noexcept
+    {
+        return in < out + len && out < in + len;
+    }
+}
+
+void parallel::set_config(const Config& config)
+{
+    if (config.chunk_size == 0) throw std::invalid_argument("Parallel chunk size must not be zero");
+    g_threshold.store(config.threshold, std::memory_order_relaxed);
+    g_chunk_size.store(config.chunk_size, std::memory_order_relaxed);
+    g_max_threads.store(config.max_threads, std::memory_order_relaxed);
+}
+
+parallel::Config parallel::config() noexcept
+{
+    return {g_threshold.load(std::memory_order_relaxed), g_chunk_size.load(std::memory_order_relaxed),
+            g_max_threads.load(std::memory_order_relaxed)};
+}
+
+unsigned parallel::thread_count() noexcept
+{
+#if defined(BYTEAO_DISABLE_PARALLEL)
+    return 1;
+#else
+    const unsigned limit = g_max_threads.load(std::memory_order_relaxed);
+    return limit == 0 ? hardware_threads() : limit;
+#endif
+}
+
+void parallel::for_each_chunk(const size_t len, const std::function<void(size_t, size_t)>& body) noexcept
+{
+    if (len == 0) return;
+#if !defined(BYTEAO_DISABLE_PARALLEL)
+    if (run_parallel(len, body)) return;
+#endif
+    body(0, len);
+}
+
+void parallel::xor_bytes(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len) noexcept
+{
+    const auto& kernels = simd::active();
+    if (len < g_threshold.load(std::memory_order_relaxed)) {
+        kernels.xor_bytes(a, b, out, len);
+        return;
+    }
+    for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        kernels.xor_bytes(a + begin, b + begin, out + begin, end - begin);
+    });
+}
+
+void parallel::complement_bytes(const unsigned char* in, unsigned char* out, const size_t len) noexcept
+{
+    const auto& kernels = simd::active();
+    if (len < g_threshold.load(std::memory_order_relaxed)) {
+        kernels.complement_bytes(in, out, len);
+        return;
+    }
+    for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        kernels.complement_bytes(in + begin, out + begin, end - begin);
+    });
+}
+
+std::uint64_t parallel::diff_bytes(const unsigned char* a, const unsigned char* b, const size_t len) noexcept
+{
+    const auto& kernels = simd::active();
+    if (len < g_threshold.load(std::memory_order_relaxed)) return kernels.diff_bytes(a, b, len);
+
+    // every chunk is scanned in full, the combined result keeps the constant time property
+    std::atomic<std::uint64_t> diff{0};
+    for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        diff.fetch_or(kernels.diff_bytes(a + begin, b + begin, end - begin), std::memory_order_relaxed);
+    });
+    return diff.load(std::memory_order_relaxed);
+}
+
+std::uint64_t parallel::or_bytes(const unsigned char* in, const size_t len) noexcept
+{
+    const auto& kernels = simd::active();
+    if (len < g_threshold.load(std::memory_order_relaxed)) return kernels.or_bytes(in, len);
+
+    std::atomic<std::uint64_t> bits{0};
+    for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        bits.fetch_or(kernels.or_bytes(in + begin, end - begin), std::memory_order_relaxed);
+    });
+    return bits.load(std::memory_order_relaxed);
+}
+
+void parallel::and_bytes(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len) noexcept
+{
+    run_binary(simd::active().and_bytes, a, b, out, len);
+}
+
+void parallel::bitor_bytes(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len) noexcept
+{
+    run_binary(simd::active().bitor_bytes, a, b, out, len);
+}
+
+void parallel::andnot_bytes(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len) noexcept
+{
+    run_binary(simd::active().andnot_bytes, a, b, out, len);
+}
+
+std::uint64_t parallel::popcount_bytes(const unsigned char* in, const size_t len) noexcept
+{
+    const auto& kernels = simd::active();
+    if (len < g_threshold.load(std::memory_order_relaxed)) return kernels.popcount_bytes(in, len);
+
+    std::atomic<std::uint64_t> count{0};
+    for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        count.fetch_add(kernels.popcount_bytes(in + begin, end - begin), std::memory_order_relaxed);
+    });
+    return count.load(std::memory_order_relaxed);
+}
+
+std::uint64_t parallel::hamming_bytes(const unsigned char* a, const unsigned char* b, const size_t len) noexcept
+{
+    const auto& kernels = simd::active();
+    if (len < g_threshold.load(std::memory_order_relaxed)) return kernels.hamming_bytes(a, b, len);
+
+    std::atomic<std::uint64_t> count{0};
+    for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        count.fetch_add(kernels.hamming_bytes(a + begin, b + begin, end - begin), std::memory_order_relaxed);
+    });
+    return count.load(std::memory_order_relaxed);
+}
+
+void parallel::shl_bits(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                        const unsigned char next) noexcept
+{
+    const auto& kernels = simd::active();
+    if (len < g_threshold.load(std::memory_order_relaxed) || overlaps(in, out, len)) {
+        kernels.shl_bits(in, out, len, bits, next);
+        return;
+    }
+    // every chunk takes its carry from the first input byte of the following one
+    for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        kernels.shl_bits(in + begin, out + begin, end - begin, bits, end < len ? in[end] : next);
+    });
+}
+
+void parallel::shr_bits(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                        const unsigned char prev) noexcept
+{
+    const auto& kernels = simd::active();
+    if (len < g_threshold.load(std::memory_order_relaxed) || overlaps(in, out, len)) {
+        kernels.shr_bits(in, out, len, bits, prev);
+        return;
+    }
+    for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        kernels.shr_bits(in + begin, out + begin, end - begin, bits, begin > 0 ? in[begin - 1] : prev);
+    });
+}
+
+bool parallel::equal_bytes(const unsigned char* a, const unsigned char* b, const size_t len) noexcept
+{
+    if (len < g_threshold.load(std::memory_order_relaxed)) return std::memcmp(a, b, len) == 0;
+
+    // chunks still to be claimed skip their memcmp once a difference has been found
+    std::atomic<bool> equal{true};
+    for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        if (equal.load(std::memory_order_relaxed) && std::memcmp(a + begin, b + begin, end - begin) != 0) {
+            equal.store(false, std::memory_order_relaxed);
+        }
+    });
+    return equal.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,313 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/random.h"
+#include "jlizard/security_ops.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <bcrypt.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__) || defined(__DragonFly__)
+#define BYTEAO_HAS_ARC4RANDOM 1
+#include <pthread.h>
+#include <stdlib.h>
+#elif defined(__linux__) && defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 25))
+#define BYTEAO_HAS_GETRANDOM 1
+#include <cerrno>
+#include <pthread.h>
+#include <sys/random.h>
+#elif defined(__unix__)
+#define BYTEAO_HAS_DEV_URANDOM 1
+#include <cerrno>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#else
+#include <random>
+#endif
+
+using namespace jlizard;
+
+namespace
+{
+    constexpr std::uint32_t rotl(const std::uint32_t v, const int n) noexcept
+    {
+        return (v << n) | (v >> (32 - n));
+    }
+
+    constexpr void quarter_round(std::uint32_t& a, std::uint32_t& b, std::uint32_t& c, std::uint32_t& d) noexcept
+    {
+        a += b; d ^= a; d = rotl(d, 16);
+        c += d; b ^= c; b = rotl(b, 12);
+        a += b; d ^= a; d = rotl(d, 8);
+        c += d; b ^= c; b = rotl(b, 7);
+    }
+
+    std::uint32_t load_le32(const unsigned char* p) noexcept
+    {
+        return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+               (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+    }
+
+    void store_le32(unsigned char* p, const std::uint32_t v) noexcept
+    {
+        p[0] = static_cast<unsigned char>(v);
+        p[1] = static_cast<unsigned char>(v >> 8);
+        p[2] = static_cast<unsigned char>(v >> 16);
+        p[3] = static_cast<unsigned char>(v >> 24);
+    }
+
+    // state words 0-3 constants, 4-11 key, 12 counter, 13-15 nonce
+    void init_state(std::uint32_t state[16], const unsigned char* key, const unsigned char* nonce) noexcept
+    {
+        state[0] = 0x61707865;
+        state[1] = 0x3320646e;
+        state[2] = 0x79622d32;
+        state[3] = 0x6b206574;
+        for (int i = 0; i < 8; ++i) state[4 + i] = load_le32(key + 4 * i);
+        state[12] = 0;
+        for (int i = 0; i < 3; ++i) state[13 + i] = load_le32(nonce + 4 * i);
+    }
+
+    void block(const std::uint32_t state[16], unsigned char* out) noexcept
+    {
+        std::uint32_t x[16];
+        std::memcpy(x, state, sizeof(x));
+        for (int round = 0; round < 10; ++round) {
+            quarter_round(x[0], x[4], x[8], x[12]);
+            quarter_round(x[1], x[5], x[9], x[13]);
+            quarter_round(x[2], x[6], x[10], x[14]);
+            quarter_round(x[3], x[7], x[11], x[15]);
+            quarter_round(x[0], x[5], x[10], x[15]);
+            quarter_round(x[1], x[6], x[11], x[12]);
+            quarter_round(x[2], x[7], x[8], x[13]);
+            quarter_round(x[3], x[4], x[9], x[14]);
+        }
+        for (int i = 0; i < 16; ++i) store_le32(out + 4 * i, x[i] + state[i]);
+    }
+
+    void wipe(void* ptr, const size_t len) noexcept
+    {
+        security::unsafe::SecureErase::secure_zero_buffer(ptr, len, security::unsafe::SecureErase::Options());
+    }
+
+#if defined(BYTEAO_HAS_ARC4RANDOM) || defined(BYTEAO_HAS_GETRANDOM) || defined(BYTEAO_HAS_DEV_URANDOM)
+    // bumped in every child process, cheaper to compare than calling getpid() per request
+    std::atomic<unsigned> g_fork_generation{0};
+
+    void on_fork_child() noexcept
+    {
+        g_fork_generation.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    unsigned fork_generation() noexcept
+    {
+        static const bool registered = pthread_atfork(nullptr, nullptr, on_fork_child) == 0;
+        (void)registered;
+        return g_fork_generation.load(std::memory_order_relaxed);
+    }
+#else
+    unsigned fork_generation() noexcept
+    {
+        return 0;
+    }
+#endif
+
+    // the key is rotated well before the 32-bit block counter could wrap
+    constexpr size_t kMaxBlocksPerKey = size_t{1} << 16;
+}
+
+void random::detail::chacha20_block(const std::span<const unsigned char, 32> key, const std::uint32_t counter,
+                                    const std::span<const unsigned char, 12> nonce,
+                                    const std::span<unsigned char, 64> out) noexcept
+{
+    std::uint32_t state[16];
+    init_state(state, key.data(), nonce.data());
+    state[12] = counter;
+    block(state, out.data());
+    wipe(state, sizeof(state));
+}
+
+void random::fill_system(unsigned char* out, size_t count)
+{
+#if defined(_WIN32)
+    while (count > 0) {
+        const ULONG chunk = static_cast<ULONG>(std::min<size_t>(count, 0x7FFFFFFF));
+        if (BCryptGenRandom(nullptr, out, chunk, BCRYPT_USE_SYSTEM_PREFERRED_RNG) != 0) {
+            throw std::runtime_error("BCryptGenRandom failed to provide random bytes");
+        }
+        out += chunk;
+        count -= chunk;
+    }
+#elif defined(BYTEAO_HAS_ARC4RANDOM)
+    // arc4random_buf cannot fail
+    arc4random_buf(out, count);
+#elif defined(BYTEAO_HAS_GETRANDOM)
+    while (count > 0) {
+        // requests above 32 MiB - 1 are truncated by the kernel, the loop picks up the rest
+        const ssize_t got = getrandom(out, count, 0);
+        if (got < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("getrandom failed to provide random bytes");
+        }
+        out += got;
+        count -= static_cast<size_t>(got);
+    }
+#elif defined(BYTEAO_HAS_DEV_URANDOM)
+    const int fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+    if (fd < 0) throw std::runtime_error("Cannot open /dev/urandom");
+    while (count > 0) {
+        const ssize_t got = read(fd, out, count);
+        if (got <= 0) {
+            if (got < 0 && errno == EINTR) continue;
+            close(fd);
+            throw std::runtime_error("Reading /dev/urandom failed");
+        }
+        out += got;
+        count -= static_cast<size_t>(got);
+    }
+    close(fd);
+#else
+    // no known OS interface, draw whole words from the standard library source
+    std::random_device rd;
+    while (count > 0) {
+        const auto word = static_cast<std::uint32_t>(rd());
+        const size_t chunk = std::min<size_t>(count, sizeof(word));
+        std::memcpy(out, &word, chunk);
+        out += chunk;
+        count -= chunk;
+    }
+#endif
+}
+
+random::ChaCha20Drbg::ChaCha20Drbg()
+{
+    reseed();
+}
+
+random::ChaCha20Drbg::ChaCha20Drbg(const std::span<const unsigned char, key_size> seed) noexcept
+    : auto_reseed_(false)
+{
+    std::memcpy(key_.data(), seed.data(), key_size);
+}
+
+random::ChaCha20Drbg::~ChaCha20Drbg()
+{
+    wipe(key_.data(), key_.size());
+    wipe(buffer_.data(), buffer_.size());
+}
+
+void random::ChaCha20Drbg::fill(unsigned char* out, size_t count)
+{
+    maybe_reseed_();
+    since_reseed_ += count;
+
+    while (count > 0) {
+        if (available_ == 0) {
+            if (count >= buffer_.size()) {
+                // large request, skip the buffer; the refill below still rotates the key
+                const size_t blocks = std::min(count / block_size, kMaxBlocksPerKey - counter_);
+                generate_blocks_(out, blocks);
+                out += blocks * block_size;
+                count -= blocks * block_size;
+            }
+            refill_();
+            continue;
+        }
+
+        const size_t take = std::min(count, available_);
+        unsigned char* first = buffer_.data() + (buffer_.size() - available_);
+        std::memcpy(out, first, take);
+        // handed out bytes must not stay in the state
+        std::memset(first, 0, take);
+        out += take;
+        count -= take;
+        available_ -= take;
+    }
+}
+
+void random::ChaCha20Drbg::reseed()
+{
+    fill_system(key_.data(), key_.size());
+    wipe(buffer_.data(), buffer_.size());
+    available_ = 0;
+    counter_ = 0;
+    since_reseed_ = 0;
+    fork_generation_ = fork_generation();
+}
+
+void random::ChaCha20Drbg::refill_() noexcept
+{
+    generate_blocks_(buffer_.data(), batch_blocks);
+
+    // fast key erasure: the head of the batch becomes the next key and is never handed out
+    std::memcpy(key_.data(), buffer_.data(), key_size);
+    std::memset(buffer_.data(), 0, key_size);
+    counter_ = 0;
+    available_ = buffer_.size() - key_size;
+}
+
+void random::ChaCha20Drbg::generate_blocks_(unsigned char* out, const size_t blocks) noexcept
+{
+    static constexpr unsigned char zero_nonce[12] = {};
+    std::uint32_t state[16];
+    init_state(state, key_.data(), zero_nonce);
+    for (size_t i = 0; i < blocks; ++i) {
+        state[12] = counter_++;
+        block(state, out + i * block_size);
+    }
+    wipe(state, sizeof(state));
+}
+
+void random::ChaCha20Drbg::maybe_reseed_()
+{
+    if (auto_reseed_ && (since_reseed_ >= reseed_interval || fork_generation_ != fork_generation())) {
+        reseed();
+    }
+}
+
+random::ChaCha20Drbg& random::thread_drbg()
+{
+    thread_local ChaCha20Drbg drbg;
+    return drbg;
+}
+
+void random::fill(unsigned char* out, const size_t count, const ERandomSource source)
+{
+    switch (source) {
+        case ERandomSource::SYSTEM:
+            fill_system(out, count);
+            return;
+        case ERandomSource::THREAD_DRBG:
+            thread_drbg().fill(out, count);
+            return;
+    }
+    throw std::invalid_argument("Unknown random source");
+}
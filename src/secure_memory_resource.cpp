@@ -0,0 +1,58 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/secure_memory_resource.h"
+#include "jlizard/security_ops.h"
+
+using namespace jlizard;
+
+void* SecureMemoryResource::do_allocate(const size_t bytes, const size_t alignment)
+{
+    void* block = upstream_->allocate(bytes, alignment);
+    live_blocks_.fetch_add(1, std::memory_order_relaxed);
+    live_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    return block;
+}
+
+void SecureMemoryResource::do_deallocate(void* p, const size_t bytes, const size_t alignment)
+{
+    // a single erase pass right before the block leaves our hands, no verification on this path
+    security::unsafe::SecureErase::secure_zero_buffer(p, bytes, security::unsafe::SecureErase::Options());
+    live_blocks_.fetch_sub(1, std::memory_order_relaxed);
+    live_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    upstream_->deallocate(p, bytes, alignment);
+}
+
+bool SecureMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    // blocks must come back through the resource that erases them
+    return this == &other;
+}
+
+SecureMemoryResource* jlizard::secure_resource() noexcept
+{
+    static SecureMemoryResource resource;
+    return &resource;
+}
@@ -23,14 +23,59 @@
  * 
  */
 #include "jlizard/security_ops.h"
+#include "jlizard/parallel_ops.h"
+#include "jlizard/stats_counters.h"
 #include <type_traits>
 #include <memory>
-#include <atomic> //needed for one of the #elif branches
-#include <string> //needed for one of the #elif branches
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
 
 using namespace jlizard::security;
 
+namespace
+{
+    // Keeps the compiler from treating the stores to ptr as dead, without a hardware fence
+    inline void compiler_barrier(void* ptr) noexcept
+    {
+#if defined(__GNUC__)
+        __asm__ __volatile__("" : : "r"(ptr) : "memory");
+#else
+        (void)ptr;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    // Fills [ptr, ptr + len) with the byte pair (even, odd) repeated, through volatile stores a
+    // machine word at a time, then one compiler barrier instead of a fence per pass
+    void volatile_fill(void* ptr, const size_t len, const unsigned char even, const unsigned char odd) noexcept
+    {
+        auto* bytes = static_cast<volatile unsigned char*>(ptr);
+        size_t i = 0;
+        // bytes up to the first word boundary
+        for (; i < len && reinterpret_cast<std::uintptr_t>(bytes + i) % alignof(std::uint64_t) != 0; ++i) {
+            bytes[i] = (i % 2 == 0) ? even : odd;
+        }
+
+        // the word continues the pair where the head stopped
+        unsigned char pattern[sizeof(std::uint64_t)];
+        for (size_t j = 0; j < sizeof(pattern); ++j) pattern[j] = ((i + j) % 2 == 0) ? even : odd;
+        std::uint64_t word;
+        std::memcpy(&word, pattern, sizeof(word));
+
+        auto* words = reinterpret_cast<volatile std::uint64_t*>(static_cast<unsigned char*>(ptr) + i);
+        const size_t word_count = (len - i) / sizeof(word);
+        for (size_t w = 0; w < word_count; ++w) {
+            words[w] = word;
+        }
+        for (i += word_count * sizeof(word); i < len; ++i) {
+            bytes[i] = (i % 2 == 0) ? even : odd;
+        }
+        compiler_barrier(ptr);
+    }
+}
+
 // Platform-specific secure memory zeroing implementations
 #if defined(_WIN32)
 #include <windows.h>
@@ -42,70 +87,38 @@ void unsafe::SecureErase::secure_zero_raw_(void* ptr, size_t len) {
 void unsafe::SecureErase::secure_zero_raw_(void* ptr, size_t len) {
     memset_s(ptr, len, 0, len);
 }
-#elif defined(__linux__) || defined(__unix__)
-#if defined(__GLIBC__) && (__GLIBC__ >= 2) && (__GLIBC_MINOR__ >= 25)
-#include <cstring>
+#elif defined(__linux__) && defined(__GLIBC__) && (__GLIBC__ >= 2) && (__GLIBC_MINOR__ >= 25)
 void unsafe::SecureErase::secure_zero_raw_(void* ptr, size_t len) {
     explicit_bzero(ptr, len);
 }
 #else
-// Fallback implementation with memory barrier for other platforms
+// Fallback implementation: word wide volatile stores followed by a compiler barrier
 void unsafe::SecureErase::secure_zero_raw_(void* ptr, size_t len) {
-    volatile unsigned char* p = static_cast<volatile unsigned char*>(ptr);
-
-    // Multi-pass overwrite with different patterns to counteract memory remanence
-    // First pass: set all bits to 0
-    for (size_t i = 0; i < len; ++i) {
-        p[i] = 0x00;
-    }
-    std::atomic_thread_fence(std::memory_order_seq_cst);
-
-    // Second pass: set all bits to 1
-    for (size_t i = 0; i < len; ++i) {
-        p[i] = 0xFF;
-    }
-    std::atomic_thread_fence(std::memory_order_seq_cst);
-
-    // Final pass: zero out
-    for (size_t i = 0; i < len; ++i) {
-        p[i] = 0x00;
-    }
-    std::atomic_thread_fence(std::memory_order_seq_cst);
+    volatile_fill(ptr, len, 0x00, 0x00);
 }
 #endif
-#else
-// Default fallback implementation
-void unsafe::SecureErase::secure_zero_raw_(void* ptr, size_t len) {
-    volatile unsigned char* p = static_cast<volatile unsigned char*>(ptr);
-
-    // Multi-pass overwrite with different patterns
-    for (size_t i = 0; i < len; ++i) {
-        p[i] = 0x00;
-    }
-    std::atomic_thread_fence(std::memory_order_seq_cst);
 
-    for (size_t i = 0; i < len; ++i) {
-        p[i] = 0xFF;
+void unsafe::SecureErase::erase_(void* ptr, const size_t len, const Options& options) {
+    if (options.multi_pass) {
+        // 0x00, 0xFF, alternating 0xAA/0x55, then the platform primitive's final 0x00
+        volatile_fill(ptr, len, 0x00, 0x00);
+        volatile_fill(ptr, len, 0xFF, 0xFF);
+        volatile_fill(ptr, len, 0xAA, 0x55);
     }
-    std::atomic_thread_fence(std::memory_order_seq_cst);
+    secure_zero_raw_(ptr, len);
+}
 
-    for (size_t i = 0; i < len; ++i) {
-        p[i] = 0x00;
-    }
-    std::atomic_thread_fence(std::memory_order_seq_cst);
+void unsafe::SecureErase::erase_parallel_(void* ptr, const size_t len, const Options& options) {
+    auto* bytes = static_cast<unsigned char*>(ptr);
+    parallel::for_each_chunk(len, [&](const size_t begin, const size_t end) {
+        erase_(bytes + begin, end - begin, options);
+    });
 }
-#endif
 
 bool unsafe::SecureErase::verify_zeroed_(const void* ptr, size_t len) {
-    const unsigned char* p = static_cast<const unsigned char*>(ptr);
-    unsigned char result = 0;
-
-    // Constant-time verification - always examine all bytes
-    for (size_t i = 0; i < len; ++i) {
-        result |= p[i];
-    }
-
-    return result == 0;
+    // Constant-time verification - the kernel ORs every byte together a word or vector at a time,
+    // large buffers are split across cores
+    return parallel::or_bytes(static_cast<const unsigned char*>(ptr), len) == 0;
 }
 
 template <typename T>
@@ -114,12 +127,15 @@ bool unsafe::SecureErase::secure_zero(T& obj, const Options& options) {
               "secure_zero can only be used on trivially copyable types");
 
     // Perform the secure erasure
-    secure_zero_raw_(static_cast<void*>(&obj), sizeof(T));
+    erase_(static_cast<void*>(&obj), sizeof(T), options);
+    JLBA_STAT_ADD(wipes, 1);
+    JLBA_STAT_ADD(bytes_wiped, sizeof(T));
 
     // Verify if required
     if (options.verify_after_erase) {
         bool verified = verify_zeroed_(static_cast<const void*>(&obj), sizeof(T));
 
+        if (!verified) JLBA_STAT_ADD(verify_failures, 1);
         if (!verified && options.throw_on_verification_failure) {
             std::stringstream ss;
             ss << "Secure erasure verification failed for object at address "
@@ -133,9 +149,35 @@ bool unsafe::SecureErase::secure_zero(T& obj, const Options& options) {
     return true;
 }
 
+bool unsafe::SecureErase::secure_zero_buffer(void* ptr, const size_t len, const Options& options) {
+    if (ptr == nullptr || len == 0) {
+        return true;
+    }
+
+    erase_parallel_(ptr, len, options);
+    JLBA_STAT_ADD(wipes, 1);
+    JLBA_STAT_ADD(bytes_wiped, len);
+
+    if (options.verify_after_erase) {
+        const bool verified = verify_zeroed_(ptr, len);
+
+        if (!verified) JLBA_STAT_ADD(verify_failures, 1);
+        if (!verified && options.throw_on_verification_failure) {
+            std::stringstream ss;
+            ss << "Secure erasure verification failed for buffer at address "
+               << ptr << " of size " << len << " bytes";
+            throw ErasureVerificationError(ss.str());
+        }
+
+        return verified;
+    }
+
+    return true;
+}
+
 // Special implementation for vectors
-template <typename T>
-bool unsafe::SecureErase::secure_zero_vector(std::vector<T>& vec, const Options& options) {
+template <typename T, typename Alloc>
+bool unsafe::SecureErase::secure_zero_vector(std::vector<T, Alloc>& vec, const Options& options) {
     static_assert(std::is_trivially_copyable_v<T>,
               "secure_zero_vector only supports vectors of trivially copyable types");
 
@@ -148,13 +190,16 @@ bool unsafe::SecureErase::secure_zero_vector(std::vector<T>& vec, const Options&
     size_t total_size = vec.size() * sizeof(T);
 
     // Perform the secure erasure
-    secure_zero_raw_(data_ptr, total_size);
+    erase_parallel_(data_ptr, total_size, options);
+    JLBA_STAT_ADD(wipes, 1);
+    JLBA_STAT_ADD(bytes_wiped, total_size);
 
     // Verify if required (must be done before swapping because swap will deallocate)
     bool verified = true;
     if (options.verify_after_erase) {
         verified = verify_zeroed_(static_cast<const void*>(vec.data()), total_size);
 
+        if (!verified) JLBA_STAT_ADD(verify_failures, 1);
         if (!verified && options.throw_on_verification_failure) {
             std::stringstream ss;
             ss << "Secure erasure verification failed for vector at address "
@@ -164,8 +209,8 @@ bool unsafe::SecureErase::secure_zero_vector(std::vector<T>& vec, const Options&
         }
     }
 
-    // Force a deallocation of the memory by swapping with an empty vector
-    std::vector<T>().swap(vec);
+    // Force a deallocation of the memory by swapping with an empty vector using the same allocator
+    std::vector<T, Alloc>(vec.get_allocator()).swap(vec);
 
     return verified;
 }
@@ -178,4 +223,6 @@ template bool unsafe::SecureErase::secure_zero<unsigned int>(unsigned int&, cons
 
 // Vector specializations (using the separate function for vectors)
 template bool unsafe::SecureErase::secure_zero_vector<unsigned char>(std::vector<unsigned char>&, const Options&);
-template bool unsafe::SecureErase::secure_zero_vector<char>(std::vector<char>&, const Options&);
\ No newline at end of file
+template bool unsafe::SecureErase::secure_zero_vector<char>(std::vector<char>&, const Options&);
+template bool unsafe::SecureErase::secure_zero_vector<unsigned char>(std::pmr::vector<unsigned char>&, const Options&);
+template bool unsafe::SecureErase::secure_zero_vector<char>(std::pmr::vector<char>&, const Options&);
\ No newline at end of file
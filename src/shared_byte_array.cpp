@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/shared_byte_array.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+using namespace jlizard;
+
+namespace
+{
+    // one allocation for the reference count and the array, wiped when the last handle lets go
+    struct Block
+    {
+        ByteArray bytes;
+
+        explicit Block(ByteArray&& adopted) noexcept : bytes(std::move(adopted)) {}
+        Block(const Block&) = delete;
+        Block& operator=(const Block&) = delete;
+
+        ~Block()
+        {
+            // a destructor cannot report a failed verification, the erase itself has happened by then
+            try {
+                bytes.secure_wipe();
+            } catch (...) {
+            }
+        }
+    };
+
+    std::shared_ptr<ByteArray> make_block(ByteArray&& bytes)
+    {
+        auto block = std::make_shared<Block>(std::move(bytes));
+        // aliasing constructor, shares the count of block but points at its array
+        return {block, &block->bytes};
+    }
+}
+
+SharedByteArray::SharedByteArray(ByteArray&& bytes) : block_(make_block(std::move(bytes)))
+{
+}
+
+SharedByteArray::SharedByteArray(const ByteView bytes) : block_(make_block(ByteArray(bytes)))
+{
+}
+
+const unsigned char& SharedByteArray::operator[](const size_t index) const
+{
+    if (index >= size()) throw std::out_of_range("SharedByteArray index out of range");
+    return data()[index];
+}
+
+SharedByteArray SharedByteArray::slice(const size_t offset, const size_t count) const
+{
+    const size_t length = size();
+    if (offset > length) throw std::out_of_range("SharedByteArray slice offset out of range");
+
+    SharedByteArray result;
+    result.block_ = block_;
+    result.offset_ = (whole_ ? 0 : offset_) + offset;
+    result.size_ = std::min(count, length - offset);
+    result.whole_ = false;
+    return result;
+}
+
+unsigned char* SharedByteArray::mutable_data()
+{
+    if (!block_) return nullptr;
+    if (block_.use_count() > 1) detach_();
+    return whole_ ? block_->data() : block_->data() + offset_;
+}
+
+ByteArray& SharedByteArray::mutable_bytes()
+{
+    if (!block_) block_ = make_block(ByteArray());
+    if (!whole_ || block_.use_count() > 1) detach_();
+    return *block_;
+}
+
+ByteArray SharedByteArray::release()
+{
+    ByteArray result;
+    if (block_) {
+        if (whole_ && block_.use_count() == 1) {
+            // the block is ours alone, the wipe policy moves along with the storage
+            result = std::move(*block_);
+        } else {
+            result = ByteArray(view());
+            result.set_wipe_policy(block_->wipe_policy());
+        }
+    }
+    reset();
+    return result;
+}
+
+void SharedByteArray::reset() noexcept
+{
+    block_.reset();
+    offset_ = 0;
+    size_ = 0;
+    whole_ = true;
+}
+
+void SharedByteArray::detach_()
+{
+    ByteArray copy(view());
+    copy.set_wipe_policy(block_->wipe_policy());
+    block_ = make_block(std::move(copy));
+    offset_ = 0;
+    size_ = 0;
+    whole_ = true;
+}
@@ -0,0 +1,763 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/simd_kernels.h"
+
+#include <bit>
+#include <cstring>
+
+// Pick the instruction sets we are able to emit. Target attributes are a GCC/Clang
+// extension, so other compilers only get the baseline kernels for their architecture.
+#if !defined(BYTEAO_DISABLE_SIMD)
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define BYTEAO_SIMD_X86 1
+#include <immintrin.h>
+#elif defined(_M_X64)
+#define BYTEAO_SIMD_X86_BASELINE 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define BYTEAO_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+#endif
+
+using namespace jlizard;
+
+namespace
+{
+    // Scalar kernels - always available and used for the vector kernels' tails
+    void xor_bytes_scalar(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        for (size_t i = 0; i < len; ++i) {
+            out[i] = a[i] ^ b[i];
+        }
+    }
+
+    void complement_bytes_scalar(const unsigned char* in, unsigned char* out, const size_t len)
+    {
+        for (size_t i = 0; i < len; ++i) {
+            out[i] = ~in[i];
+        }
+    }
+
+    std::uint64_t load_word(const unsigned char* p) noexcept
+    {
+        std::uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        return word;
+    }
+
+    // word at a time, the accumulators never feed a branch
+    std::uint64_t diff_bytes_scalar(const unsigned char* a, const unsigned char* b, const size_t len)
+    {
+        std::uint64_t acc = 0;
+        size_t i = 0;
+        for (; i + 8 <= len; i += 8) {
+            acc |= load_word(a + i) ^ load_word(b + i);
+        }
+        for (; i < len; ++i) {
+            acc |= static_cast<std::uint64_t>(a[i] ^ b[i]);
+        }
+        return acc;
+    }
+
+    std::uint64_t or_bytes_scalar(const unsigned char* in, const size_t len)
+    {
+        std::uint64_t acc = 0;
+        size_t i = 0;
+        for (; i + 8 <= len; i += 8) {
+            acc |= load_word(in + i);
+        }
+        for (; i < len; ++i) {
+            acc |= in[i];
+        }
+        return acc;
+    }
+
+    // the element-wise operations sharing one kernel template per instruction set
+    enum class BitOp { AND, OR, ANDNOT };
+
+    template <BitOp Op>
+    unsigned char apply_scalar(const unsigned char a, const unsigned char b)
+    {
+        if constexpr (Op == BitOp::AND) return a & b;
+        else if constexpr (Op == BitOp::OR) return a | b;
+        else return a & static_cast<unsigned char>(~b);
+    }
+
+    template <BitOp Op>
+    void bitwise_scalar(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        for (size_t i = 0; i < len; ++i) {
+            out[i] = apply_scalar<Op>(a[i], b[i]);
+        }
+    }
+
+    std::uint64_t popcount_scalar(const unsigned char* in, const size_t len)
+    {
+        std::uint64_t count = 0;
+        size_t i = 0;
+        for (; i + 8 <= len; i += 8) {
+            count += static_cast<std::uint64_t>(std::popcount(load_word(in + i)));
+        }
+        for (; i < len; ++i) {
+            count += static_cast<std::uint64_t>(std::popcount(in[i]));
+        }
+        return count;
+    }
+
+    std::uint64_t hamming_scalar(const unsigned char* a, const unsigned char* b, const size_t len)
+    {
+        std::uint64_t count = 0;
+        size_t i = 0;
+        for (; i + 8 <= len; i += 8) {
+            count += static_cast<std::uint64_t>(std::popcount(load_word(a + i) ^ load_word(b + i)));
+        }
+        for (; i < len; ++i) {
+            count += static_cast<std::uint64_t>(std::popcount(static_cast<unsigned char>(a[i] ^ b[i])));
+        }
+        return count;
+    }
+
+    // ascending, in[i + 1] is read before out[i + 1] is written
+    void shl_bits_scalar(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                         const unsigned char next)
+    {
+        for (size_t i = 0; i < len; ++i) {
+            const unsigned char following = i + 1 < len ? in[i + 1] : next;
+            out[i] = static_cast<unsigned char>(in[i] << bits | following >> (8 - bits));
+        }
+    }
+
+    // descending, in[i - 1] is read before out[i - 1] is written
+    void shr_bits_scalar(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                         const unsigned char prev)
+    {
+        for (size_t i = len; i-- > 0;) {
+            const unsigned char preceding = i > 0 ? in[i - 1] : prev;
+            out[i] = static_cast<unsigned char>(in[i] >> bits | preceding << (8 - bits));
+        }
+    }
+
+    constexpr simd::Kernels kScalarKernels{xor_bytes_scalar, complement_bytes_scalar, diff_bytes_scalar,
+                                           or_bytes_scalar, bitwise_scalar<BitOp::AND>, bitwise_scalar<BitOp::OR>,
+                                           bitwise_scalar<BitOp::ANDNOT>, popcount_scalar, hamming_scalar,
+                                           shl_bits_scalar, shr_bits_scalar, "scalar"};
+
+#if defined(BYTEAO_SIMD_X86) || defined(BYTEAO_SIMD_X86_BASELINE)
+#if defined(BYTEAO_SIMD_X86)
+#define BYTEAO_TARGET(isa) __attribute__((target(isa)))
+#else
+#define BYTEAO_TARGET(isa)
+#endif
+
+    BYTEAO_TARGET("sse2")
+    void xor_bytes_sse2(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(va, vb));
+        }
+        xor_bytes_scalar(a + i, b + i, out + i, len - i);
+    }
+
+    BYTEAO_TARGET("sse2")
+    void complement_bytes_sse2(const unsigned char* in, unsigned char* out, const size_t len)
+    {
+        const __m128i ones = _mm_set1_epi8(static_cast<char>(0xFF));
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(v, ones));
+        }
+        complement_bytes_scalar(in + i, out + i, len - i);
+    }
+
+    BYTEAO_TARGET("sse2")
+    std::uint64_t fold_sse2(const __m128i acc)
+    {
+        alignas(16) std::uint64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        return lanes[0] | lanes[1];
+    }
+
+    BYTEAO_TARGET("sse2")
+    std::uint64_t diff_bytes_sse2(const unsigned char* a, const unsigned char* b, const size_t len)
+    {
+        __m128i acc = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            acc = _mm_or_si128(acc, _mm_xor_si128(va, vb));
+        }
+        return fold_sse2(acc) | diff_bytes_scalar(a + i, b + i, len - i);
+    }
+
+    BYTEAO_TARGET("sse2")
+    std::uint64_t or_bytes_sse2(const unsigned char* in, const size_t len)
+    {
+        __m128i acc = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            acc = _mm_or_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)));
+        }
+        return fold_sse2(acc) | or_bytes_scalar(in + i, len - i);
+    }
+
+    template <BitOp Op>
+    BYTEAO_TARGET("sse2")
+    __m128i apply_sse2(const __m128i a, const __m128i b)
+    {
+        if constexpr (Op == BitOp::AND) return _mm_and_si128(a, b);
+        else if constexpr (Op == BitOp::OR) return _mm_or_si128(a, b);
+        else return _mm_andnot_si128(b, a);
+    }
+
+    template <BitOp Op>
+    BYTEAO_TARGET("sse2")
+    void bitwise_sse2(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), apply_sse2<Op>(va, vb));
+        }
+        bitwise_scalar<Op>(a + i, b + i, out + i, len - i);
+    }
+
+    // per 64 bit lane bit counts of v, SWAR reduction to nibbles then a byte sum
+    BYTEAO_TARGET("sse2")
+    __m128i popcount_lanes_sse2(__m128i v)
+    {
+        const __m128i m1 = _mm_set1_epi8(0x55);
+        const __m128i m2 = _mm_set1_epi8(0x33);
+        const __m128i m4 = _mm_set1_epi8(0x0F);
+        v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi16(v, 1), m1));
+        v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi16(v, 2), m2));
+        v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi16(v, 4)), m4);
+        return _mm_sad_epu8(v, _mm_setzero_si128());
+    }
+
+    BYTEAO_TARGET("sse2")
+    std::uint64_t sum_sse2(const __m128i acc)
+    {
+        alignas(16) std::uint64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        return lanes[0] + lanes[1];
+    }
+
+    BYTEAO_TARGET("sse2")
+    std::uint64_t popcount_sse2(const unsigned char* in, const size_t len)
+    {
+        __m128i acc = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            acc = _mm_add_epi64(acc, popcount_lanes_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+        }
+        return sum_sse2(acc) + popcount_scalar(in + i, len - i);
+    }
+
+    BYTEAO_TARGET("sse2")
+    std::uint64_t hamming_sse2(const unsigned char* a, const unsigned char* b, const size_t len)
+    {
+        __m128i acc = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            acc = _mm_add_epi64(acc, popcount_lanes_sse2(_mm_xor_si128(va, vb)));
+        }
+        return sum_sse2(acc) + hamming_scalar(a + i, b + i, len - i);
+    }
+
+    // x86 has no byte shifts: shift 16 bit lanes and mask off the bits that crossed into the other byte
+    BYTEAO_TARGET("sse2")
+    void shl_bits_sse2(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                       const unsigned char next)
+    {
+        const __m128i left = _mm_cvtsi32_si128(static_cast<int>(bits));
+        const __m128i right = _mm_cvtsi32_si128(static_cast<int>(8 - bits));
+        const __m128i left_mask = _mm_set1_epi8(static_cast<char>(0xFF << bits));
+        const __m128i right_mask = _mm_set1_epi8(static_cast<char>(0xFF >> (8 - bits)));
+        size_t i = 0;
+        // both loads happen before the store, so out may equal or precede in
+        for (; i + 17 <= len; i += 16) {
+            const __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            const __m128i following = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 1));
+            const __m128i high = _mm_and_si128(_mm_sll_epi16(cur, left), left_mask);
+            const __m128i low = _mm_and_si128(_mm_srl_epi16(following, right), right_mask);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_or_si128(high, low));
+        }
+        shl_bits_scalar(in + i, out + i, len - i, bits, next);
+    }
+
+    BYTEAO_TARGET("sse2")
+    void shr_bits_sse2(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                       const unsigned char prev)
+    {
+        const __m128i right = _mm_cvtsi32_si128(static_cast<int>(bits));
+        const __m128i left = _mm_cvtsi32_si128(static_cast<int>(8 - bits));
+        const __m128i right_mask = _mm_set1_epi8(static_cast<char>(0xFF >> bits));
+        const __m128i left_mask = _mm_set1_epi8(static_cast<char>(0xFF << (8 - bits)));
+        size_t i = len;
+        // descending, so out may equal or follow in
+        for (; i >= 17; i -= 16) {
+            const __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i - 16));
+            const __m128i preceding = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i - 17));
+            const __m128i low = _mm_and_si128(_mm_srl_epi16(cur, right), right_mask);
+            const __m128i high = _mm_and_si128(_mm_sll_epi16(preceding, left), left_mask);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i - 16), _mm_or_si128(high, low));
+        }
+        shr_bits_scalar(in, out, i, bits, prev);
+    }
+
+    constexpr simd::Kernels kSse2Kernels{xor_bytes_sse2, complement_bytes_sse2, diff_bytes_sse2, or_bytes_sse2,
+                                         bitwise_sse2<BitOp::AND>, bitwise_sse2<BitOp::OR>, bitwise_sse2<BitOp::ANDNOT>,
+                                         popcount_sse2, hamming_sse2, shl_bits_sse2, shr_bits_sse2, "sse2"};
+#endif
+
+#if defined(BYTEAO_SIMD_X86)
+    BYTEAO_TARGET("avx2")
+    void xor_bytes_avx2(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        size_t i = 0;
+        // two registers per iteration to keep both load ports busy
+        for (; i + 64 <= len; i += 64) {
+            const __m256i va0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            const __m256i vb0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            const __m256i va1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32));
+            const __m256i vb1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_xor_si256(va0, vb0));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 32), _mm256_xor_si256(va1, vb1));
+        }
+        for (; i + 32 <= len; i += 32) {
+            const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_xor_si256(va, vb));
+        }
+        xor_bytes_sse2(a + i, b + i, out + i, len - i);
+    }
+
+    BYTEAO_TARGET("avx2")
+    void complement_bytes_avx2(const unsigned char* in, unsigned char* out, const size_t len)
+    {
+        const __m256i ones = _mm256_set1_epi8(static_cast<char>(0xFF));
+        size_t i = 0;
+        for (; i + 32 <= len; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_xor_si256(v, ones));
+        }
+        complement_bytes_sse2(in + i, out + i, len - i);
+    }
+
+    BYTEAO_TARGET("avx2")
+    std::uint64_t fold_avx2(const __m256i acc)
+    {
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        return lanes[0] | lanes[1] | lanes[2] | lanes[3];
+    }
+
+    BYTEAO_TARGET("avx2")
+    std::uint64_t diff_bytes_avx2(const unsigned char* a, const unsigned char* b, const size_t len)
+    {
+        // two independent accumulators, like the XOR kernel
+        __m256i acc0 = _mm256_setzero_si256();
+        __m256i acc1 = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64) {
+            const __m256i va0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            const __m256i vb0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            const __m256i va1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32));
+            const __m256i vb1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32));
+            acc0 = _mm256_or_si256(acc0, _mm256_xor_si256(va0, vb0));
+            acc1 = _mm256_or_si256(acc1, _mm256_xor_si256(va1, vb1));
+        }
+        return fold_avx2(_mm256_or_si256(acc0, acc1)) | diff_bytes_sse2(a + i, b + i, len - i);
+    }
+
+    BYTEAO_TARGET("avx2")
+    std::uint64_t or_bytes_avx2(const unsigned char* in, const size_t len)
+    {
+        __m256i acc0 = _mm256_setzero_si256();
+        __m256i acc1 = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64) {
+            acc0 = _mm256_or_si256(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)));
+            acc1 = _mm256_or_si256(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 32)));
+        }
+        return fold_avx2(_mm256_or_si256(acc0, acc1)) | or_bytes_sse2(in + i, len - i);
+    }
+
+    template <BitOp Op>
+    BYTEAO_TARGET("avx2")
+    __m256i apply_avx2(const __m256i a, const __m256i b)
+    {
+        if constexpr (Op == BitOp::AND) return _mm256_and_si256(a, b);
+        else if constexpr (Op == BitOp::OR) return _mm256_or_si256(a, b);
+        else return _mm256_andnot_si256(b, a);
+    }
+
+    template <BitOp Op>
+    BYTEAO_TARGET("avx2")
+    void bitwise_avx2(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64) {
+            const __m256i va0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            const __m256i vb0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            const __m256i va1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32));
+            const __m256i vb1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), apply_avx2<Op>(va0, vb0));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + 32), apply_avx2<Op>(va1, vb1));
+        }
+        bitwise_sse2<Op>(a + i, b + i, out + i, len - i);
+    }
+
+    // per 64 bit lane bit counts of v through a nibble lookup table (vpshufb)
+    BYTEAO_TARGET("avx2")
+    __m256i popcount_lanes_avx2(const __m256i v)
+    {
+        const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                               0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low_nibbles = _mm256_set1_epi8(0x0F);
+        const __m256i low = _mm256_and_si256(v, low_nibbles);
+        const __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_nibbles);
+        const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(table, low), _mm256_shuffle_epi8(table, high));
+        return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+    }
+
+    BYTEAO_TARGET("avx2")
+    std::uint64_t sum_avx2(const __m256i acc)
+    {
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    BYTEAO_TARGET("avx2")
+    std::uint64_t popcount_avx2(const unsigned char* in, const size_t len)
+    {
+        __m256i acc = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 32 <= len; i += 32) {
+            acc = _mm256_add_epi64(acc, popcount_lanes_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i))));
+        }
+        return sum_avx2(acc) + popcount_sse2(in + i, len - i);
+    }
+
+    BYTEAO_TARGET("avx2")
+    std::uint64_t hamming_avx2(const unsigned char* a, const unsigned char* b, const size_t len)
+    {
+        __m256i acc = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 32 <= len; i += 32) {
+            const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            acc = _mm256_add_epi64(acc, popcount_lanes_avx2(_mm256_xor_si256(va, vb)));
+        }
+        return sum_avx2(acc) + hamming_sse2(a + i, b + i, len - i);
+    }
+
+    BYTEAO_TARGET("avx2")
+    void shl_bits_avx2(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                       const unsigned char next)
+    {
+        const __m128i left = _mm_cvtsi32_si128(static_cast<int>(bits));
+        const __m128i right = _mm_cvtsi32_si128(static_cast<int>(8 - bits));
+        const __m256i left_mask = _mm256_set1_epi8(static_cast<char>(0xFF << bits));
+        const __m256i right_mask = _mm256_set1_epi8(static_cast<char>(0xFF >> (8 - bits)));
+        size_t i = 0;
+        for (; i + 33 <= len; i += 32) {
+            const __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            const __m256i following = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 1));
+            const __m256i high = _mm256_and_si256(_mm256_sll_epi16(cur, left), left_mask);
+            const __m256i low = _mm256_and_si256(_mm256_srl_epi16(following, right), right_mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_or_si256(high, low));
+        }
+        shl_bits_sse2(in + i, out + i, len - i, bits, next);
+    }
+
+    BYTEAO_TARGET("avx2")
+    void shr_bits_avx2(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                       const unsigned char prev)
+    {
+        const __m128i right = _mm_cvtsi32_si128(static_cast<int>(bits));
+        const __m128i left = _mm_cvtsi32_si128(static_cast<int>(8 - bits));
+        const __m256i right_mask = _mm256_set1_epi8(static_cast<char>(0xFF >> bits));
+        const __m256i left_mask = _mm256_set1_epi8(static_cast<char>(0xFF << (8 - bits)));
+        size_t i = len;
+        for (; i >= 33; i -= 32) {
+            const __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i - 32));
+            const __m256i preceding = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i - 33));
+            const __m256i low = _mm256_and_si256(_mm256_srl_epi16(cur, right), right_mask);
+            const __m256i high = _mm256_and_si256(_mm256_sll_epi16(preceding, left), left_mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i - 32), _mm256_or_si256(high, low));
+        }
+        shr_bits_sse2(in, out, i, bits, prev);
+    }
+
+    constexpr simd::Kernels kAvx2Kernels{xor_bytes_avx2, complement_bytes_avx2, diff_bytes_avx2, or_bytes_avx2,
+                                         bitwise_avx2<BitOp::AND>, bitwise_avx2<BitOp::OR>, bitwise_avx2<BitOp::ANDNOT>,
+                                         popcount_avx2, hamming_avx2, shl_bits_avx2, shr_bits_avx2, "avx2"};
+
+    BYTEAO_TARGET("avx512f")
+    void xor_bytes_avx512(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64) {
+            const __m512i va = _mm512_loadu_si512(a + i);
+            const __m512i vb = _mm512_loadu_si512(b + i);
+            _mm512_storeu_si512(out + i, _mm512_xor_si512(va, vb));
+        }
+        xor_bytes_avx2(a + i, b + i, out + i, len - i);
+    }
+
+    BYTEAO_TARGET("avx512f")
+    void complement_bytes_avx512(const unsigned char* in, unsigned char* out, const size_t len)
+    {
+        const __m512i ones = _mm512_set1_epi32(-1);
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64) {
+            const __m512i v = _mm512_loadu_si512(in + i);
+            _mm512_storeu_si512(out + i, _mm512_xor_si512(v, ones));
+        }
+        complement_bytes_avx2(in + i, out + i, len - i);
+    }
+
+    BYTEAO_TARGET("avx512f")
+    std::uint64_t fold_avx512(const __m512i acc)
+    {
+        alignas(64) std::uint64_t lanes[8];
+        _mm512_store_si512(lanes, acc);
+        std::uint64_t folded = 0;
+        for (const std::uint64_t lane : lanes) folded |= lane;
+        return folded;
+    }
+
+    BYTEAO_TARGET("avx512f")
+    std::uint64_t diff_bytes_avx512(const unsigned char* a, const unsigned char* b, const size_t len)
+    {
+        __m512i acc = _mm512_setzero_si512();
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64) {
+            acc = _mm512_or_si512(acc, _mm512_xor_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+        }
+        return fold_avx512(acc) | diff_bytes_avx2(a + i, b + i, len - i);
+    }
+
+    BYTEAO_TARGET("avx512f")
+    std::uint64_t or_bytes_avx512(const unsigned char* in, const size_t len)
+    {
+        __m512i acc = _mm512_setzero_si512();
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64) {
+            acc = _mm512_or_si512(acc, _mm512_loadu_si512(in + i));
+        }
+        return fold_avx512(acc) | or_bytes_avx2(in + i, len - i);
+    }
+
+    template <BitOp Op>
+    BYTEAO_TARGET("avx512f")
+    void bitwise_avx512(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64) {
+            const __m512i va = _mm512_loadu_si512(a + i);
+            const __m512i vb = _mm512_loadu_si512(b + i);
+            if constexpr (Op == BitOp::AND) _mm512_storeu_si512(out + i, _mm512_and_si512(va, vb));
+            else if constexpr (Op == BitOp::OR) _mm512_storeu_si512(out + i, _mm512_or_si512(va, vb));
+            // a & ~b as a truth table (0xF0 & ~0xCC), _mm512_andnot_si512 trips -Wmaybe-uninitialized on GCC 12
+            else _mm512_storeu_si512(out + i, _mm512_ternarylogic_epi64(va, vb, vb, 0x30));
+        }
+        bitwise_avx2<Op>(a + i, b + i, out + i, len - i);
+    }
+
+    // byte shuffles, byte shifts and vector popcount need AVX-512BW/VPOPCNTDQ, AVX-512F keeps the AVX2 kernels
+    constexpr simd::Kernels kAvx512Kernels{xor_bytes_avx512, complement_bytes_avx512, diff_bytes_avx512,
+                                           or_bytes_avx512, bitwise_avx512<BitOp::AND>, bitwise_avx512<BitOp::OR>,
+                                           bitwise_avx512<BitOp::ANDNOT>, popcount_avx2, hamming_avx2,
+                                           shl_bits_avx2, shr_bits_avx2, "avx512"};
+#endif
+
+#if defined(BYTEAO_SIMD_NEON)
+    void xor_bytes_neon(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            vst1q_u8(out + i, veorq_u8(vld1q_u8(a + i), vld1q_u8(b + i)));
+        }
+        xor_bytes_scalar(a + i, b + i, out + i, len - i);
+    }
+
+    void complement_bytes_neon(const unsigned char* in, unsigned char* out, const size_t len)
+    {
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            vst1q_u8(out + i, vmvnq_u8(vld1q_u8(in + i)));
+        }
+        complement_bytes_scalar(in + i, out + i, len - i);
+    }
+
+    std::uint64_t fold_neon(const uint8x16_t acc)
+    {
+        const uint64x2_t lanes = vreinterpretq_u64_u8(acc);
+        return vgetq_lane_u64(lanes, 0) | vgetq_lane_u64(lanes, 1);
+    }
+
+    std::uint64_t diff_bytes_neon(const unsigned char* a, const unsigned char* b, const size_t len)
+    {
+        uint8x16_t acc = vdupq_n_u8(0);
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            acc = vorrq_u8(acc, veorq_u8(vld1q_u8(a + i), vld1q_u8(b + i)));
+        }
+        return fold_neon(acc) | diff_bytes_scalar(a + i, b + i, len - i);
+    }
+
+    std::uint64_t or_bytes_neon(const unsigned char* in, const size_t len)
+    {
+        uint8x16_t acc = vdupq_n_u8(0);
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            acc = vorrq_u8(acc, vld1q_u8(in + i));
+        }
+        return fold_neon(acc) | or_bytes_scalar(in + i, len - i);
+    }
+
+    template <BitOp Op>
+    void bitwise_neon(const unsigned char* a, const unsigned char* b, unsigned char* out, const size_t len)
+    {
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            const uint8x16_t va = vld1q_u8(a + i);
+            const uint8x16_t vb = vld1q_u8(b + i);
+            if constexpr (Op == BitOp::AND) vst1q_u8(out + i, vandq_u8(va, vb));
+            else if constexpr (Op == BitOp::OR) vst1q_u8(out + i, vorrq_u8(va, vb));
+            else vst1q_u8(out + i, vbicq_u8(va, vb));
+        }
+        bitwise_scalar<Op>(a + i, b + i, out + i, len - i);
+    }
+
+    std::uint64_t popcount_neon(const unsigned char* in, const size_t len)
+    {
+        uint64x2_t acc = vdupq_n_u64(0);
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            acc = vpadalq_u32(acc, vpaddlq_u16(vpaddlq_u8(vcntq_u8(vld1q_u8(in + i)))));
+        }
+        return vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1) + popcount_scalar(in + i, len - i);
+    }
+
+    std::uint64_t hamming_neon(const unsigned char* a, const unsigned char* b, const size_t len)
+    {
+        uint64x2_t acc = vdupq_n_u64(0);
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16) {
+            const uint8x16_t diff = veorq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+            acc = vpadalq_u32(acc, vpaddlq_u16(vpaddlq_u8(vcntq_u8(diff))));
+        }
+        return vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1) + hamming_scalar(a + i, b + i, len - i);
+    }
+
+    // NEON shifts bytes directly, a negative count shifts right
+    void shl_bits_neon(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                       const unsigned char next)
+    {
+        const int8x16_t left = vdupq_n_s8(static_cast<int8_t>(bits));
+        const int8x16_t right = vdupq_n_s8(static_cast<int8_t>(static_cast<int>(bits) - 8));
+        size_t i = 0;
+        for (; i + 17 <= len; i += 16) {
+            const uint8x16_t cur = vld1q_u8(in + i);
+            const uint8x16_t following = vld1q_u8(in + i + 1);
+            vst1q_u8(out + i, vorrq_u8(vshlq_u8(cur, left), vshlq_u8(following, right)));
+        }
+        shl_bits_scalar(in + i, out + i, len - i, bits, next);
+    }
+
+    void shr_bits_neon(const unsigned char* in, unsigned char* out, const size_t len, const unsigned bits,
+                       const unsigned char prev)
+    {
+        const int8x16_t right = vdupq_n_s8(static_cast<int8_t>(-static_cast<int>(bits)));
+        const int8x16_t left = vdupq_n_s8(static_cast<int8_t>(8 - bits));
+        size_t i = len;
+        for (; i >= 17; i -= 16) {
+            const uint8x16_t cur = vld1q_u8(in + i - 16);
+            const uint8x16_t preceding = vld1q_u8(in + i - 17);
+            vst1q_u8(out + i - 16, vorrq_u8(vshlq_u8(cur, right), vshlq_u8(preceding, left)));
+        }
+        shr_bits_scalar(in, out, i, bits, prev);
+    }
+
+    constexpr simd::Kernels kNeonKernels{xor_bytes_neon, complement_bytes_neon, diff_bytes_neon, or_bytes_neon,
+                                         bitwise_neon<BitOp::AND>, bitwise_neon<BitOp::OR>, bitwise_neon<BitOp::ANDNOT>,
+                                         popcount_neon, hamming_neon, shl_bits_neon, shr_bits_neon, "neon"};
+#endif
+
+    const simd::Kernels& detect_kernels() noexcept
+    {
+#if defined(BYTEAO_SIMD_X86) && defined(BYTEAO_NATIVE_ARCH)
+        // built with -march=native, the widest instruction set of the build machine is known here
+#if defined(__AVX512F__)
+        return kAvx512Kernels;
+#elif defined(__AVX2__)
+        return kAvx2Kernels;
+#else
+        return kSse2Kernels;
+#endif
+#elif defined(BYTEAO_SIMD_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return kAvx512Kernels;
+        if (__builtin_cpu_supports("avx2")) return kAvx2Kernels;
+        if (__builtin_cpu_supports("sse2")) return kSse2Kernels;
+#elif defined(BYTEAO_SIMD_X86_BASELINE)
+        return kSse2Kernels;
+#elif defined(BYTEAO_SIMD_NEON)
+        return kNeonKernels;
+#endif
+        return kScalarKernels;
+    }
+}
+
+const simd::Kernels& simd::active() noexcept
+{
+#if defined(BYTEAO_NATIVE_ARCH)
+    // fixed at compile time, no detection and no initialisation guard on every call
+    return detect_kernels();
+#else
+    // function local static so detection runs once and is thread-safe
+    static const Kernels& kernels = detect_kernels();
+    return kernels;
+#endif
+}
+
+const simd::Kernels& simd::scalar() noexcept
+{
+    return kScalarKernels;
+}
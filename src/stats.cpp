@@ -0,0 +1,190 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/stats.h"
+#include "jlizard/stats_counters.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+using namespace jlizard;
+using stats::detail::ThreadCounters;
+
+namespace
+{
+    // visits every field of a block together with the matching Counters field
+    template <typename Fn>
+    void for_each_field(ThreadCounters& block, stats::Counters& counters, Fn&& fn)
+    {
+        fn(block.allocations, counters.allocations);
+        fn(block.allocated_bytes, counters.allocated_bytes);
+        fn(block.deallocations, counters.deallocations);
+        fn(block.reallocations, counters.reallocations);
+        fn(block.copies, counters.copies);
+        fn(block.bytes_copied, counters.bytes_copied);
+        fn(block.wipes, counters.wipes);
+        fn(block.bytes_wiped, counters.bytes_wiped);
+        fn(block.verify_failures, counters.verify_failures);
+    }
+
+    stats::Counters read(ThreadCounters& block) noexcept
+    {
+        stats::Counters counters;
+        for_each_field(block, counters, [](const auto& counter, std::uint64_t& value) { value = counter.load(); });
+        return counters;
+    }
+
+    struct Registration;
+
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<Registration*> live;
+        // what exited threads counted since the last reset()
+        stats::Counters retired;
+    };
+
+    Registry& registry() noexcept
+    {
+        // never destroyed, threads may still exit and fold in their counts during static destruction
+        static auto* instance = new Registry();
+        return *instance;
+    }
+
+    struct Registration
+    {
+        ThreadCounters counters;
+        // the counts at the last reset(), guarded by the registry mutex. reset() never writes
+        // the counters themselves, which only their owning thread may do
+        stats::Counters baseline;
+
+        Registration()
+        {
+            Registry& reg = registry();
+            std::lock_guard lock(reg.mutex);
+            reg.live.push_back(this);
+        }
+
+        ~Registration()
+        {
+            Registry& reg = registry();
+            std::lock_guard lock(reg.mutex);
+            reg.retired += since_reset();
+            reg.live.erase(std::remove(reg.live.begin(), reg.live.end(), this), reg.live.end());
+        }
+
+        // requires the registry mutex
+        [[nodiscard]] stats::Counters since_reset() noexcept { return read(counters) - baseline; }
+    };
+
+    Registration& local_registration() noexcept
+    {
+        thread_local Registration registration;
+        return registration;
+    }
+}
+
+ThreadCounters& stats::detail::local() noexcept
+{
+    return local_registration().counters;
+}
+
+stats::Counters& stats::Counters::operator+=(const Counters& other) noexcept
+{
+    allocations += other.allocations;
+    allocated_bytes += other.allocated_bytes;
+    deallocations += other.deallocations;
+    reallocations += other.reallocations;
+    copies += other.copies;
+    bytes_copied += other.bytes_copied;
+    wipes += other.wipes;
+    bytes_wiped += other.bytes_wiped;
+    verify_failures += other.verify_failures;
+    return *this;
+}
+
+stats::Counters stats::Counters::operator-(const Counters& other) const noexcept
+{
+    Counters diff = *this;
+    diff.allocations -= other.allocations;
+    diff.allocated_bytes -= other.allocated_bytes;
+    diff.deallocations -= other.deallocations;
+    diff.reallocations -= other.reallocations;
+    diff.copies -= other.copies;
+    diff.bytes_copied -= other.bytes_copied;
+    diff.wipes -= other.wipes;
+    diff.bytes_wiped -= other.bytes_wiped;
+    diff.verify_failures -= other.verify_failures;
+    return diff;
+}
+
+bool stats::enabled() noexcept
+{
+#if defined(BYTEAO_ENABLE_STATS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+stats::Counters stats::thread_snapshot() noexcept
+{
+#if defined(BYTEAO_ENABLE_STATS)
+    Registration& own = local_registration();
+    Registry& reg = registry();
+    std::lock_guard lock(reg.mutex);
+    return own.since_reset();
+#else
+    return {};
+#endif
+}
+
+stats::Counters stats::snapshot() noexcept
+{
+#if defined(BYTEAO_ENABLE_STATS)
+    Registry& reg = registry();
+    std::lock_guard lock(reg.mutex);
+    Counters total = reg.retired;
+    for (Registration* thread : reg.live) {
+        total += thread->since_reset();
+    }
+    return total;
+#else
+    return {};
+#endif
+}
+
+void stats::reset() noexcept
+{
+#if defined(BYTEAO_ENABLE_STATS)
+    Registry& reg = registry();
+    std::lock_guard lock(reg.mutex);
+    reg.retired = {};
+    for (Registration* thread : reg.live) {
+        thread->baseline = read(thread->counters);
+    }
+#endif
+}
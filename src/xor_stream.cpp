@@ -0,0 +1,146 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Salem B.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES, OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "jlizard/xor_stream.h"
+#include "jlizard/parallel_ops.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+using namespace jlizard;
+
+XorStream::XorStream(const EMode mode, const size_t block_size)
+    : mode_(mode), block_size_(block_size)
+{
+    if (block_size_ == 0) {
+        throw std::invalid_argument("XorStream block size must be at least one byte");
+    }
+}
+
+XorStream::XorStream(KeystreamSource source, const size_t block_size)
+    : XorStream(EMode::GENERATED, block_size)
+{
+    if (!source) {
+        throw std::invalid_argument("XorStream needs a keystream source");
+    }
+    source_ = std::move(source);
+    keystream_ = ByteArray(block_size_, 0x00);
+    // nothing generated yet, the first update refills
+    keystream_pos_ = keystream_.size();
+}
+
+XorStream XorStream::repeating(const ByteView key, const size_t block_size)
+{
+    if (key.empty()) {
+        throw std::invalid_argument("XorStream key must not be empty");
+    }
+
+    XorStream stream(EMode::REPEATING, block_size);
+    // a whole number of key repetitions, so wrapping around the buffer continues the key seamlessly
+    const size_t repetitions = (stream.block_size_ + key.size() - 1) / key.size();
+    stream.block_size_ = repetitions * key.size();
+    stream.keystream_ = ByteArray::create_with_prealloc(stream.block_size_);
+    for (size_t i = 0; i < repetitions; ++i) {
+        stream.keystream_.concat(key);
+    }
+    return stream;
+}
+
+XorStream XorStream::complement(const size_t block_size)
+{
+    return XorStream(EMode::COMPLEMENT, block_size);
+}
+
+void XorStream::update(const ByteView in, ByteArray& out)
+{
+    const auto in_begin = reinterpret_cast<std::uintptr_t>(in.data());
+    const auto block_begin = reinterpret_cast<std::uintptr_t>(out.bytes_.data());
+    const bool overlaps = !in.empty() && in_begin < block_begin + out.bytes_.capacity() &&
+                          block_begin < in_begin + in.size();
+    if (overlaps && in.data() != out.bytes_.data()) {
+        // partially overlapping input, the kernels only support exact aliasing
+        const ByteArray copy(in);
+        update(copy, out);
+        return;
+    }
+
+    // in place input stays where it is, the new size never exceeds the block it lives in
+    out.bytes_.resize_uninitialized(in.size());
+    update(in, out.bytes_.data());
+}
+
+void XorStream::update(const ByteView in, unsigned char* out)
+{
+    if (mode_ == EMode::COMPLEMENT) {
+        parallel::complement_bytes(in.data(), out, in.size());
+        position_ += in.size();
+        return;
+    }
+
+    const unsigned char* src = in.data();
+    size_t remaining = in.size();
+    while (remaining > 0) {
+        if (keystream_pos_ == keystream_.size()) refill_();
+        const size_t take = std::min(remaining, keystream_.size() - keystream_pos_);
+        parallel::xor_bytes(src, keystream_.data() + keystream_pos_, out, take);
+        keystream_pos_ += take;
+        src += take;
+        out += take;
+        remaining -= take;
+    }
+    position_ += in.size();
+}
+
+std::uint64_t XorStream::process(std::istream& in, std::ostream& out)
+{
+    ByteArray buffer(block_size_, 0x00);
+    std::uint64_t processed = 0;
+    while (in) {
+        in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        const auto got = static_cast<size_t>(in.gcount());
+        if (got == 0) break;
+
+        update(ByteView(buffer.data(), got), buffer.data());
+        out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(got));
+        if (!out) {
+            throw std::runtime_error("Writing the XOR stream output failed");
+        }
+        processed += got;
+    }
+    return processed;
+}
+
+void XorStream::refill_()
+{
+    if (mode_ == EMode::GENERATED) {
+        source_(keystream_.data(), keystream_.size());
+    }
+    // a repeating keystream buffer is reused as is
+    keystream_pos_ = 0;
+}
@@ -24,13 +24,39 @@
  *
  */
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 
 #include "jlizard/byte_array.h"
+#include "jlizard/byte_array_batch.h"
+#include "jlizard/byte_chain.h"
+#include "jlizard/byte_reader.h"
+#include "jlizard/byte_writer.h"
+#include "jlizard/fixed_byte_array.h"
+#include "jlizard/mapped_byte_array.h"
+#include "jlizard/parallel.h"
+#include "jlizard/secure_memory_resource.h"
+#include "jlizard/shared_byte_array.h"
+#include "jlizard/stats.h"
+#include "jlizard/xor_stream.h"
 #include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
 #include <functional>
 #include <sstream>
+#include <system_error>
+#include <thread>
 #include <iostream>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#if defined(JLBA_HAS_WRITEV)
+#include <unistd.h>
+#endif
 
 using namespace jlizard;
 
@@ -243,6 +269,275 @@ void test_iterators() {
     assert(prod == 0x18);  // 0x01 * 0x02 * 0x03 * 0x04 = 0x18
 }
 
+// true if the ByteArray's bytes live inside the object itself
+bool is_stored_inline(const ByteArray& ba) {
+    const auto* object_begin = reinterpret_cast<const unsigned char*>(&ba);
+    const unsigned char* bytes = ba.begin();
+    return bytes >= object_begin && bytes < object_begin + sizeof(ByteArray);
+}
+
+// Test the unchecked accessors and mutable iterators
+void test_unchecked_access() {
+    ByteArray ba({0x30, 0x10, 0x20});
+
+    // mutable iteration writes in place
+    for (auto& byte : ba) {
+        byte = static_cast<unsigned char>(byte + 1);
+    }
+    assert(ba == ByteArray({0x31, 0x11, 0x21}));
+    std::sort(ba.begin(), ba.end());
+    assert(ba == ByteArray({0x11, 0x21, 0x31}));
+    static_assert(std::is_same_v<decltype(ba.begin()), ByteArray::iterator>);
+    static_assert(std::is_same_v<decltype(std::as_const(ba).begin()), ByteArray::const_iterator>);
+    static_assert(std::is_same_v<decltype(ba.cbegin()), ByteArray::const_iterator>);
+
+    // unchecked element access reads and writes like at()
+    ba.unchecked(0) = 0xAA;
+    assert(ba.at(0) == 0xAA);
+    const ByteArray& cref = ba;
+    unsigned sum = 0;
+    for (size_t i = 0; i < cref.size(); ++i) {
+        sum += cref.unchecked(i);
+    }
+    assert(sum == 0xAA + 0x21 + 0x31);
+    assert(cref.data() == cref.begin());
+
+    PRINT_PASSED();
+}
+
+// Test the inline small-buffer storage
+void test_small_buffer_storage() {
+    // default constructed and small arrays never leave the object
+    const ByteArray empty;
+    assert(is_stored_inline(empty));
+    assert(empty.capacity() == ByteArray::INLINE_CAPACITY);
+
+    const ByteArray single(static_cast<unsigned char>(0x42));
+    assert(is_stored_inline(single));
+
+    const ByteArray full(ByteArray::INLINE_CAPACITY, 0xAB);
+    assert(is_stored_inline(full));
+
+    // one byte more moves to the heap
+    const ByteArray large(ByteArray::INLINE_CAPACITY + 1, 0xCD);
+    assert(!is_stored_inline(large));
+    assert(large.size() == ByteArray::INLINE_CAPACITY + 1);
+
+    // growing past the inline capacity keeps the contents
+    ByteArray growing({0x01, 0x02});
+    for (size_t i = 0; i < ByteArray::INLINE_CAPACITY; ++i) {
+        growing.concat(ByteArray({static_cast<unsigned char>(i)}));
+    }
+    assert(!is_stored_inline(growing));
+    assert(growing.size() == ByteArray::INLINE_CAPACITY + 2);
+    assert(growing[0] == 0x01 && growing[1] == 0x02);
+    for (size_t i = 0; i < ByteArray::INLINE_CAPACITY; ++i) {
+        assert(growing[i + 2] == static_cast<unsigned char>(i));
+    }
+
+    // self concatenation across the inline boundary
+    ByteArray self(ByteArray::INLINE_CAPACITY, 0x11);
+    self.concat(self);
+    assert(self == ByteArray(2 * ByteArray::INLINE_CAPACITY, 0x11));
+
+    // copies and moves of inline arrays stay inline and independent, sized so any inline capacity holds them
+    ByteArray original(ByteArray::INLINE_CAPACITY, 0xAA);
+    ByteArray copy = original; // NOLINT
+    ByteArray moved(std::move(original));
+    assert(is_stored_inline(copy) && is_stored_inline(moved));
+    assert(copy == moved);
+    copy.at(0) = 0x00;
+    assert(moved[0] == 0xAA);
+
+    // moving a heap array hands over its block
+    ByteArray heap(ByteArray::INLINE_CAPACITY + 68, 0x5A);
+    const unsigned char* heap_bytes = heap.begin();
+    ByteArray heap_moved(std::move(heap));
+    assert(heap_moved.begin() == heap_bytes);
+
+    // secure wipe erases the inline buffer as well
+    ByteArray secret(ByteArray::INLINE_CAPACITY, 0xDE);
+    const unsigned char* secret_bytes = secret.begin();
+    assert(is_stored_inline(secret));
+    assert(secret.secure_wipe());
+    assert(secret.empty());
+    for (size_t i = 0; i < ByteArray::INLINE_CAPACITY; ++i) {
+        assert(secret_bytes[i] == 0x00);
+    }
+
+    PRINT_PASSED();
+}
+
+// memory resource that counts outstanding allocations and forwards to new/delete
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    size_t outstanding_bytes = 0;
+
+private:
+    void* do_allocate(const size_t bytes, const size_t alignment) override {
+        ++allocations;
+        outstanding_bytes += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, const size_t bytes, const size_t alignment) override {
+        ++deallocations;
+        outstanding_bytes -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Test ByteArrays backed by a custom memory resource
+void test_memory_resource_allocation() {
+    // default constructed arrays use the default resource
+    const ByteArray plain;
+    assert(plain.get_allocator().resource() == std::pmr::get_default_resource());
+
+    // a stack arena with no upstream: any allocation outside the buffer would throw
+    {
+        std::array<std::byte, 16384> buffer{};
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+        const auto* buffer_begin = reinterpret_cast<const unsigned char*>(buffer.data());
+
+        // enough parts to leave the inline buffer for any BYTEAO_INLINE_CAPACITY
+        const size_t parts = ByteArray::INLINE_CAPACITY / 50 + 10;
+        ByteArray frame(&arena);
+        for (size_t i = 0; i < parts; ++i) {
+            frame.concat(ByteArray(50, static_cast<unsigned char>(i)));
+        }
+        assert(frame.size() == parts * 50);
+        assert(frame[parts * 50 - 1] == parts - 1);
+        assert(frame.begin() >= buffer_begin && frame.end() <= buffer_begin + buffer.size());
+
+        auto prealloc = ByteArray::create_with_prealloc(256, &arena);
+        assert(prealloc.capacity() >= 256);
+        assert(prealloc.get_allocator().resource() == &arena);
+
+        // secure wipe erases the arena memory before handing it back
+        const unsigned char* frame_bytes = frame.begin();
+        const size_t frame_capacity = frame.capacity();
+        assert(frame.secure_wipe());
+        assert(frame.empty());
+        for (size_t i = 0; i < frame_capacity; ++i) {
+            assert(frame_bytes[i] == 0x00);
+        }
+    }
+
+    // allocations and deallocations balance and moves keep the resource
+    CountingResource counting;
+    {
+        ByteArray a(&counting);
+        a.resize(ByteArray::INLINE_CAPACITY * 4);
+        assert(counting.allocations == 1);
+
+        // plain copies use the default resource, copies with an allocator use the given one
+        const ByteArray default_copy(a);
+        assert(default_copy.get_allocator().resource() == std::pmr::get_default_resource());
+        const ByteArray counted_copy(a, &counting);
+        assert(counted_copy.get_allocator().resource() == &counting);
+        assert(counted_copy == a);
+        assert(counting.allocations == 2);
+
+        ByteArray moved(std::move(a));
+        assert(moved.get_allocator().resource() == &counting);
+        assert(counting.allocations == 2);
+
+        // assignment keeps the target's resource and copies across resources
+        ByteArray target;
+        target = std::move(moved);
+        assert(target.get_allocator().resource() == std::pmr::get_default_resource());
+        assert(target == counted_copy);
+        assert(counting.outstanding_bytes > 0);
+    }
+    assert(counting.allocations == counting.deallocations);
+    assert(counting.outstanding_bytes == 0);
+
+    PRINT_PASSED();
+}
+
+// upstream resource that records whether every block came back zeroed
+class ZeroCheckingResource : public std::pmr::memory_resource {
+public:
+    size_t deallocations = 0;
+    size_t dirty_deallocations = 0;
+
+private:
+    void* do_allocate(const size_t bytes, const size_t alignment) override {
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, const size_t bytes, const size_t alignment) override {
+        ++deallocations;
+        const auto* bytes_ptr = static_cast<const unsigned char*>(p);
+        for (size_t i = 0; i < bytes; ++i) {
+            if (bytes_ptr[i] != 0x00) {
+                ++dirty_deallocations;
+                break;
+            }
+        }
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Test the secure memory resource erasing blocks on deallocation
+void test_secure_memory_resource() {
+    ZeroCheckingResource upstream;
+    jlizard::SecureMemoryResource secure(&upstream);
+    {
+        // growth reallocates several times, every abandoned block must be erased
+        ByteArray key(&secure);
+        for (int i = 0; i < 20; ++i) {
+            key.concat(ByteArray(ByteArray::INLINE_CAPACITY, static_cast<unsigned char>(0xA0 + i)));
+        }
+        assert(key.size() == 20 * ByteArray::INLINE_CAPACITY);
+        assert(key[0] == 0xA0 && key[key.size() - 1] == 0xB3);
+        assert(upstream.deallocations > 0);
+        assert(secure.live_blocks() == 1);
+        assert(secure.live_bytes() == key.capacity());
+
+        // moves keep the resource
+        ByteArray moved(std::move(key));
+        assert(secure.live_blocks() == 1);
+        assert(moved.get_allocator().resource() == &secure);
+
+        // secure_wipe just releases, the resource erases
+        assert(moved.secure_wipe());
+        assert(moved.empty());
+        assert(secure.live_blocks() == 0);
+    }
+    assert(upstream.dirty_deallocations == 0);
+    assert(secure.live_bytes() == 0);
+
+    // the inline buffer is erased when its contents move to the heap
+    ByteArray small(&secure);
+    small.concat(ByteArray(ByteArray::INLINE_CAPACITY, 0xDE));
+    assert(is_stored_inline(small));
+    const auto* object_bytes = reinterpret_cast<const unsigned char*>(&small);
+    const unsigned char* inline_bytes = small.begin();
+    small.concat(ByteArray(ByteArray::INLINE_CAPACITY, 0x11));
+    assert(!is_stored_inline(small));
+    assert(small[0] == 0xDE && small[ByteArray::INLINE_CAPACITY - 1] == 0xDE);
+    for (size_t i = 0; i < ByteArray::INLINE_CAPACITY; ++i) {
+        assert(inline_bytes[i] == 0x00);
+    }
+    assert(inline_bytes >= object_bytes);
+    small.clear();
+
+    // the process-wide secure resource
+    ByteArray global(jlizard::secure_resource());
+    global.resize(ByteArray::INLINE_CAPACITY + 68);
+    assert(global.get_allocator().resource() == jlizard::secure_resource());
+    assert(jlizard::secure_resource()->live_blocks() >= 1);
+
+    PRINT_PASSED();
+}
+
 // Test secure erase functionality
 void test_secure_erase() {
     // Test with a non-empty ByteArray
@@ -402,6 +697,154 @@ void test_as_64bit_uint_exceptions() {
     assert(boundary_array.as_64bit_uint() == expected);
 }
 
+// compile time round trips through the constexpr fixed-size conversions
+static_assert(jlizard::byte_order::to_bytes(std::uint32_t{0x11223344}) == std::array<unsigned char, 4>{0x11, 0x22, 0x33, 0x44});
+static_assert(jlizard::byte_order::to_bytes<EByteOrder::LSB_FIRST>(std::uint16_t{0x1122}) == std::array<unsigned char, 2>{0x22, 0x11});
+static_assert(jlizard::byte_order::from_bytes<std::uint64_t>({0, 0, 0, 0, 0, 0, 0x01, 0x02}) == 0x0102);
+static_assert(jlizard::byte_order::byteswap(std::uint64_t{0x0102030405060708}) == 0x0807060504030201);
+
+// FixedByteArray works in constant expressions
+static_assert(FixedByteArray<4>("deadbeef") == FixedByteArray<4>({0xDE, 0xAD, 0xBE, 0xEF}));
+static_assert((FixedByteArray<2>({0x0F, 0xF0}) ^ FixedByteArray<2>({0xFF, 0xFF})) == FixedByteArray<2>({0xF0, 0x0F}));
+static_assert(~FixedByteArray<1>() == FixedByteArray<1>::filled(0xFF));
+static_assert(std::is_trivially_copyable_v<FixedByteArray<16>>);
+static_assert(sizeof(FixedByteArray<12>) == 12);
+
+// Test the compile-time sized FixedByteArray
+void test_fixed_byte_array() {
+    FixedByteArray<16> block;
+    assert(block == FixedByteArray<16>::filled(0x00));
+    assert(block.size() == 16);
+
+    // same XOR / complement / hex API as ByteArray
+    const FixedByteArray<4> key("0ff0aa55");
+    FixedByteArray<4> value({0xDE, 0xAD, 0xBE, 0xEF});
+    assert((value ^ key).as_hex_string() == "d15d14ba");
+    value ^= key;
+    assert(value == FixedByteArray<4>("d15d14ba"));
+    assert((value ^ static_cast<unsigned char>(0x01)).as_hex_string() == "d15d14bb");
+    assert((~key).as_hex_string() == "f00f55aa");
+    char hex[8];
+    assert(key.to_hex_chars(hex, hex + sizeof(hex)).ec == std::errc{});
+    assert(std::string_view(hex, sizeof(hex)) == "0ff0aa55");
+
+    // unchecked and checked access, mutable iteration
+    value[0] = 0x00;
+    assert(value.at(0) == 0x00);
+    for (auto& byte : value) {
+        byte = 0x11;
+    }
+    assert(value == FixedByteArray<4>::filled(0x11));
+    bool threw = false;
+    try {
+        (void)value.at(4);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // size mismatches are rejected
+    threw = false;
+    try {
+        const FixedByteArray<4> wrong("dead");
+        (void)wrong;
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        const FixedByteArray<2> wrong({0x01});
+        (void)wrong;
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        const FixedByteArray<2> wrong("zz00");
+        (void)wrong;
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // conversion to and from ByteArray through the pad/truncate constructor
+    const ByteArray dynamic = {0x01, 0x02, 0x03};
+    assert(FixedByteArray<5>::from(dynamic).as_hex_string() == "0102030000");
+    assert(FixedByteArray<5>::from(dynamic, EZeroPadDir::MSB_PAD).as_hex_string() == "0000010203");
+    assert(FixedByteArray<2>::from(dynamic).as_hex_string() == "0102");
+    assert(FixedByteArray<2>::from(dynamic, EZeroPadDir::MSB_PAD).as_hex_string() == "0203");
+    const ByteArray back = key.to_byte_array();
+    assert(back == ByteArray({0x0F, 0xF0, 0xAA, 0x55}));
+
+    // mixes with ByteArray operands through ByteView
+    assert(back == key);
+    const ByteArray mixed = back ^ key;
+    assert(mixed == ByteArray(4, 0x00));
+    assert(ByteArray(key ^ dynamic).as_hex_string() == "0ff1a856");
+
+    // secure wipe
+    FixedByteArray<32> secret = FixedByteArray<32>::filled(0xA5);
+    assert(secret.secure_wipe());
+    assert(secret == FixedByteArray<32>());
+
+    PRINT_PASSED();
+}
+
+// Test the generalised integral conversions
+void test_integral_conversions() {
+    // fixed width, network order by default
+    const ByteArray u16 = ByteArray::create_from_integral<std::uint16_t>(0x01BB);
+    assert(u16 == ByteArray({0x01, 0xBB}));
+    assert(u16.as_integral<std::uint16_t>() == 443);
+    const ByteArray u32 = ByteArray::create_from_integral<std::uint32_t>(42);
+    assert(u32 == ByteArray({0x00, 0x00, 0x00, 0x2A}));
+    const ByteArray u64 = ByteArray::create_from_integral(std::uint64_t{0x1122334455667788});
+    assert(u64.as_hex_string() == "1122334455667788");
+    assert(u64.as_integral<std::uint64_t>() == u64.as_64bit_uint());
+    assert(ByteArray::create_from_integral<std::uint8_t>(0xFE) == ByteArray({0xFE}));
+
+    // little endian chosen at compile time
+    const ByteArray le = ByteArray::create_from_integral<std::uint32_t, EByteOrder::LSB_FIRST>(0x11223344);
+    assert(le == ByteArray({0x44, 0x33, 0x22, 0x11}));
+    assert((le.as_integral<std::uint32_t, EByteOrder::LSB_FIRST>() == 0x11223344));
+    assert(le.as_integral<std::uint32_t>() == 0x44332211);
+
+    // shorter inputs miss their most significant bytes
+    assert(ByteArray({0x12, 0x34}).as_integral<std::uint32_t>() == 0x1234);
+    assert((ByteArray({0x12, 0x34}).as_integral<std::uint32_t, EByteOrder::LSB_FIRST>() == 0x3412));
+    assert(ByteArray().as_integral<std::uint16_t>() == 0);
+    assert(ByteView(u64).last(3).as_integral<std::uint32_t>() == 0x667788);
+
+    bool threw = false;
+    try {
+        (void)u32.as_integral<std::uint16_t>();
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 wide = (static_cast<unsigned __int128>(0x0001020304050607) << 64) | 0x08090A0B0C0D0E0F;
+    const ByteArray u128 = ByteArray::create_from_integral(wide);
+    assert(u128.as_hex_string() == "000102030405060708090a0b0c0d0e0f");
+    assert(u128.as_integral<unsigned __int128>() == wide);
+    assert((ByteArray::create_from_integral<unsigned __int128, EByteOrder::LSB_FIRST>(wide)[0] == 0x0F));
+#endif
+
+    // minimal width create_from_uint64 across every byte length
+    for (size_t bytes = 1; bytes <= 8; ++bytes) {
+        const std::uint64_t value = bytes == 8 ? ~std::uint64_t{0} : (std::uint64_t{1} << (8 * bytes)) - 1;
+        const ByteArray minimal = ByteArray::create_from_uint64(value);
+        assert(minimal.size() == bytes);
+        assert(minimal.as_64bit_uint() == value);
+        assert(ByteArray::create_from_uint64(std::uint64_t{1} << (8 * (bytes - 1))).size() == bytes);
+    }
+
+    PRINT_PASSED();
+}
+
 // Test size and value constructor
 void test_size_and_value_constructor() {
     // Test with non-zero value
@@ -547,6 +990,393 @@ void test_complement_operators() {
     assert(b1[2] == static_cast<unsigned char>(~0xCC)); // 0x33
 }
 
+// Test in-place XOR-assignment including the growth path and self XOR
+void test_xor_assign_in_place() {
+    // left operand longer than the right one: only the rightmost bytes change
+    ByteArray longer({0x10, 0x20, 0x30, 0x40});
+    const ByteArray shorter({0x0F, 0xF0});
+    const unsigned char* data_before = longer.data();
+    longer ^= shorter;
+    assert(longer == ByteArray({0x10, 0x20, 0x3F, 0xB0}));
+    assert(longer.data() == data_before); // no reallocation
+
+    // left operand shorter: grows with leading zeros, same result as operator^
+    ByteArray grow({0xAA, 0xBB});
+    const ByteArray wide({0x01, 0x02, 0x03, 0x04});
+    const ByteArray expected = grow ^ wide;
+    grow ^= wide;
+    assert(grow.size() == 4);
+    assert(grow == expected);
+    assert(grow == ByteArray({0x01, 0x02, 0xA9, 0xBF}));
+
+    // empty left operand takes over the right operand
+    ByteArray empty;
+    empty ^= wide;
+    assert(empty == wide);
+
+    // self XOR zeroes the array
+    ByteArray self({0xDE, 0xAD, 0xBE, 0xEF});
+    self ^= self;
+    assert(self == ByteArray(4, 0x00));
+
+    // single byte on an empty array
+    ByteArray empty_byte;
+    empty_byte ^= 0x5A;
+    assert(empty_byte.size() == 1);
+    assert(empty_byte[0] == 0x5A);
+
+    PRINT_PASSED();
+}
+
+// Test XOR of a single byte against an empty array
+void test_xor_byte_with_empty_array() {
+    const ByteArray empty;
+    const ByteArray result = empty ^ 0x5A;
+    assert(result.size() == 1);
+    assert(result[0] == 0x5A);
+
+    // XOR of two empty arrays stays empty
+    assert(ByteArray(empty ^ empty).empty());
+
+    PRINT_PASSED();
+}
+
+// Test XOR and complement on buffers large enough to hit every vector width and tail length
+void test_bulk_xor_and_complement() {
+    const std::array<size_t, 12> sizes = {1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 200, 4099};
+
+    for (const size_t size : sizes) {
+        std::vector<unsigned char> lhs_bytes(size);
+        std::vector<unsigned char> rhs_bytes(size);
+        for (size_t i = 0; i < size; ++i) {
+            lhs_bytes[i] = static_cast<unsigned char>(i * 7 + 3);
+            rhs_bytes[i] = static_cast<unsigned char>(i * 13 + 1);
+        }
+        const ByteArray lhs(lhs_bytes);
+        const ByteArray rhs(rhs_bytes);
+
+        // equal lengths
+        const ByteArray xored = lhs ^ rhs;
+        assert(xored.size() == size);
+        for (size_t i = 0; i < size; ++i) {
+            assert(xored[i] == (lhs_bytes[i] ^ rhs_bytes[i]));
+        }
+
+        // right-aligned with a shorter operand
+        const ByteArray shorter(rhs_bytes.begin(), rhs_bytes.begin() + static_cast<long>(size / 2));
+        const ByteArray mixed = lhs ^ shorter;
+        const size_t offset = size - shorter.size();
+        assert(mixed.size() == size);
+        for (size_t i = 0; i < size; ++i) {
+            const unsigned char expected = i < offset ? lhs_bytes[i] : lhs_bytes[i] ^ rhs_bytes[i - offset];
+            assert(mixed[i] == expected);
+        }
+
+        const ByteArray complemented = ~lhs;
+        assert(complemented.size() == size);
+        for (size_t i = 0; i < size; ++i) {
+            assert(complemented[i] == static_cast<unsigned char>(~lhs_bytes[i]));
+        }
+    }
+
+    PRINT_PASSED();
+}
+
+// Test the non-owning ByteView and the operations accepting it
+void test_byte_view() {
+    const std::vector<unsigned char> packet = {0x01, 0x02, 0xDE, 0xAD, 0xBE, 0xEF, 0x03};
+
+    // implicit conversions from the usual containers
+    const ByteView whole(packet);
+    assert(whole.size() == packet.size() && whole.data() == packet.data());
+    const ByteArray array = {0xDE, 0xAD, 0xBE, 0xEF};
+    const ByteView array_view = array;
+    assert(array_view.data() == array.begin());
+    const std::array<unsigned char, 2> fixed = {0xAB, 0xCD};
+    assert(ByteView(fixed).as_hex_string() == "abcd");
+    assert(ByteView().empty());
+
+    // slicing without copies
+    const ByteView payload = whole.subview(2, 4);
+    assert(payload.data() == packet.data() + 2);
+    assert(payload.size() == 4);
+    assert(payload == array);
+    assert(array == payload);
+    assert(whole.subview(5).size() == 2);
+    assert(whole.subview(7).empty());
+    assert(whole.first(2).as_hex_string() == "0102");
+    assert(whole.last(1)[0] == 0x03);
+    assert(whole.first(100).size() == whole.size());
+    bool threw = false;
+    try {
+        (void)whole.subview(8);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        (void)payload.at(4);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // read-only operations on views
+    assert(payload.as_hex_string() == "deadbeef");
+    assert(payload.as_64bit_uint() == 0xDEADBEEF);
+    threw = false;
+    try {
+        (void)ByteView(ByteArray(9, 0x01)).as_64bit_uint();
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    std::string hex = "0x";
+    whole.first(2).append_hex_to(hex);
+    assert(hex == "0x0102");
+
+    // XOR and complement accept views on either side
+    const ByteArray key = {0xFF, 0xFF, 0xFF, 0xFF};
+    assert((payload ^ key) == ByteArray({0x21, 0x52, 0x41, 0x10}));
+    assert((key ^ payload) == ByteArray({0x21, 0x52, 0x41, 0x10}));
+    assert((payload ^ whole.first(1)) == ByteArray({0xDE, 0xAD, 0xBE, 0xEE}));
+    assert(~payload == ByteArray({0x21, 0x52, 0x41, 0x10}));
+    ByteArray masked = key;
+    masked ^= payload;
+    assert(masked == ~array);
+
+    // owning copies and concatenation of slices
+    ByteArray copy(payload);
+    assert(copy == array && copy.begin() != payload.data());
+    copy.concat(whole.last(1));
+    assert(copy.as_hex_string() == "deadbeef03");
+    assert(array.concat_copy(whole.first(1)).as_hex_string() == "deadbeef01");
+
+    // a view into the array itself
+    ByteArray self = {0x0F, 0xF0};
+    self.concat(ByteView(self).first(1));
+    assert(self.as_hex_string() == "0ff00f");
+    self ^= ByteView(self).last(1);
+    assert(self.as_hex_string() == "0ff000");
+
+    // views of other parts of the array behave like a copy of the viewed bytes
+    const size_t overlaps[][3] = {{20, 5, 10}, {200, 5, 150}, {200, 40, 150}, {4096, 1, 4000}, {64, 0, 32}, {30, 0, 30}};
+    for (const auto& [size, offset, count] : overlaps) {
+        std::vector<unsigned char> pattern(size);
+        for (size_t i = 0; i < size; ++i) pattern[i] = static_cast<unsigned char>(i * 7 + 5);
+        ByteArray viewed(pattern);
+        ByteArray copied = viewed;
+        viewed ^= ByteView(viewed).subview(offset, count);
+        copied ^= ByteArray(ByteView(copied).subview(offset, count));
+        assert(viewed == copied);
+    }
+
+    PRINT_PASSED();
+}
+
+// Test the result-reusing xor_into / complement_into / concat_into
+void test_into_operations() {
+    const ByteArray a = {0x0F, 0xF0, 0xAA};
+    const ByteArray b = {0xFF, 0x55};
+
+    // results match the allocating operators
+    ByteArray out;
+    ByteArray::xor_into(a, b, out);
+    assert(out == (a ^ b));
+    ByteArray::xor_into(b, a, out);
+    assert(out == (b ^ a));
+    ByteArray::xor_into(a, static_cast<unsigned char>(0x0F), out);
+    assert(out == (a ^ static_cast<unsigned char>(0x0F)));
+    ByteArray::complement_into(a, out);
+    assert(out == ~a);
+    ByteArray::concat_into({a, b, ByteView(a).first(1)}, out);
+    assert(out.as_hex_string() == "0ff0aaff550f");
+
+    // a scratch buffer with enough capacity is reused without reallocation
+    const ByteArray big_a(200, 0x5A);
+    const ByteArray big_b(150, 0xA5);
+    ByteArray scratch = ByteArray::create_with_prealloc(512);
+    const unsigned char* scratch_bytes = scratch.begin();
+    for (int i = 0; i < 3; ++i) {
+        ByteArray::xor_into(big_a, big_b, scratch);
+        assert(scratch == (big_a ^ big_b));
+        ByteArray::complement_into(big_b, scratch);
+        assert(scratch == ~big_b);
+        ByteArray::concat_into({big_a, big_b}, scratch);
+        assert(scratch.size() == 350);
+        ByteArray::xor_into(big_b, static_cast<unsigned char>(0x01), scratch);
+        assert(scratch.size() == 150 && scratch[149] == 0xA4);
+    }
+    assert(scratch.begin() == scratch_bytes);
+    assert(scratch.capacity() == 512);
+
+    // out may be one of the operands
+    ByteArray inout = {0x01, 0x02, 0x03};
+    ByteArray::xor_into(inout, b, inout);
+    assert(inout == (ByteArray({0x01, 0x02, 0x03}) ^ b));
+    inout = {0x01, 0x02, 0x03};
+    ByteArray::xor_into(b, inout, inout);
+    assert(inout == (ByteArray({0x01, 0x02, 0x03}) ^ b));
+    inout = {0x01, 0x02};
+    ByteArray::xor_into(inout, a, inout); // grows
+    assert(inout == (ByteArray({0x01, 0x02}) ^ a));
+    ByteArray::xor_into(inout, inout, inout);
+    assert(inout == ByteArray(3, 0x00));
+    inout = {0x01, 0x02, 0x03, 0x04};
+    ByteArray::xor_into(inout, ByteView(inout).last(2), inout); // partial overlap
+    assert(inout == (ByteArray({0x01, 0x02, 0x03, 0x04}) ^ ByteArray({0x03, 0x04})));
+    ByteArray::xor_into(ByteView(inout).first(2), static_cast<unsigned char>(0xFF), inout);
+    assert(inout == ByteArray({0x01, 0xFD}));
+    ByteArray::complement_into(inout, inout);
+    assert(inout == ByteArray({0xFE, 0x02}));
+    inout = {0xAA, 0xBB, 0xCC};
+    ByteArray::complement_into(ByteView(inout).last(2), inout);
+    assert(inout == ByteArray({0x44, 0x33}));
+    ByteArray::concat_into({inout, inout, b}, inout);
+    assert(inout.as_hex_string() == "44334433ff55");
+
+    // empty input to complement_into still throws
+    bool threw = false;
+    try {
+        ByteArray::complement_into(ByteView(), out);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    PRINT_PASSED();
+}
+
+// eager reference results for the lazy expression tests
+ByteArray eager_xor(const ByteView a, const ByteView b) {
+    ByteArray out;
+    ByteArray::xor_into(a, b, out);
+    return out;
+}
+
+ByteArray eager_not(const ByteView a) {
+    ByteArray out;
+    ByteArray::complement_into(a, out);
+    return out;
+}
+
+ByteArray patterned(const size_t size, const unsigned char seed) {
+    ByteArray result(size, 0x00);
+    for (size_t i = 0; i < size; ++i) {
+        result.at(i) = static_cast<unsigned char>(i * 13 + seed);
+    }
+    return result;
+}
+
+// Test the small-array fast paths of ^= and the single byte XOR against the kernel paths
+void test_inline_xor_paths() {
+    // operands on both sides of the inline fast path ceiling agree with the fused kernel path
+    for (const size_t left_size : {1, 63, 64, 65, 200}) {
+        for (const size_t right_size : {1, 63, 64, 65, 200}) {
+            ByteArray left = patterned(left_size, 1);
+            const ByteArray right = patterned(right_size, 2);
+            const ByteArray fused(left ^ right);
+            left ^= right;
+            assert(left == fused);
+        }
+    }
+
+    // the right-aligned tail of the array itself still XORs in place on the inline path
+    ByteArray tail = patterned(100, 6);
+    tail ^= ByteView(tail).last(40);
+    assert(ByteView(tail).last(40) == ByteArray(40, 0x00));
+    assert(ByteView(tail).first(60) == ByteView(patterned(100, 6)).first(60));
+
+    // a copy XORed with one byte keeps the source intact, the temporary reuses its storage
+    const ByteArray source = patterned(40, 3);
+    const ByteArray flipped = source ^ 0xFF;
+    assert(flipped.size() == 40 && flipped[39] == static_cast<unsigned char>(source[39] ^ 0xFF));
+    assert(ByteView(flipped).first(39) == ByteView(source).first(39));
+    const size_t heap_size = ByteArray::INLINE_CAPACITY + 68;
+    ByteArray temporary = patterned(heap_size, 4);
+    const unsigned char* temporary_data = temporary.data();
+    const ByteArray reused = std::move(temporary) ^ 0x01;
+    assert(reused.data() == temporary_data);
+    assert(ByteView(reused).subview(10, 2).as_64bit_uint() == ByteView(patterned(heap_size, 4)).subview(10, 2).as_64bit_uint());
+
+    PRINT_PASSED();
+}
+
+// Test the lazily evaluated chains of ^ and ~
+void test_expression_templates() {
+    // operators build nodes, evaluation happens on assignment
+    const ByteArray a = {0x0F, 0xF0, 0xAA};
+    const ByteArray b = {0xFF, 0x00, 0x55};
+    const ByteArray c = {0x12, 0x34, 0x56};
+    static_assert(jlizard::expr::is_expression_v<decltype(a ^ b ^ ~c)>);
+    const ByteArray mask = a ^ b ^ ~c;
+    assert(mask == eager_xor(eager_xor(a, b), eager_not(c)));
+    assert((a ^ b ^ ~c) == mask);
+    assert(ByteArray(~(a ^ b)) == eager_not(eager_xor(a, b)));
+    assert(ByteArray(~~a) == a);
+
+    // right alignment and zero padding at every level, across several chunk sizes
+    for (const size_t size : {size_t{1}, size_t{7}, size_t{64}, size_t{513}, size_t{3000}}) {
+        const ByteArray x = patterned(size, 1);
+        const ByteArray y = patterned(size / 2 + 1, 7);
+        const ByteArray z = patterned(size / 3 + 2, 11);
+
+        const ByteArray lazy1 = x ^ ~y ^ z;
+        assert(lazy1 == eager_xor(eager_xor(x, eager_not(y)), z));
+
+        const ByteArray lazy2 = ~z ^ (y ^ ~x);
+        assert(lazy2 == eager_xor(eager_not(z), eager_xor(y, eager_not(x))));
+
+        const ByteArray lazy3 = ~(~z ^ y);
+        assert(lazy3 == eager_not(eager_xor(eager_not(z), y)));
+
+        // views take part as well
+        const ByteView slice = ByteView(x).last(size / 4 + 1);
+        const ByteArray lazy4 = slice ^ (y ^ z);
+        assert(lazy4 == eager_xor(slice, eager_xor(y, z)));
+    }
+
+    // assignment reuses the target and may alias its operands
+    ByteArray target = ByteArray::create_with_prealloc(16);
+    const unsigned char* target_bytes = target.begin();
+    target = a ^ b ^ c;
+    assert(target == eager_xor(eager_xor(a, b), c));
+    assert(target.begin() == target_bytes);
+
+    ByteArray inplace = {0x01, 0x02, 0x03};
+    inplace = inplace ^ b ^ ~c;
+    assert(inplace == eager_xor(eager_xor(ByteArray({0x01, 0x02, 0x03}), b), eager_not(c)));
+
+    ByteArray shorter = {0x01};
+    shorter = ~shorter ^ a ^ b; // grows, evaluated aside
+    assert(shorter == eager_xor(eager_xor(eager_not(ByteArray({0x01})), a), b));
+
+    ByteArray compound = {0xAA, 0xBB, 0xCC};
+    compound ^= b ^ ~c;
+    assert(compound == eager_xor(ByteArray({0xAA, 0xBB, 0xCC}), eager_xor(b, eager_not(c))));
+    ByteArray partial = {0x10, 0x20, 0x30, 0x40};
+    partial = ByteView(partial).first(2) ^ ~ByteView(partial).last(3) ^ a;
+    assert(partial == eager_xor(eager_xor(ByteArray({0x10, 0x20}), eager_not(ByteArray({0x20, 0x30, 0x40}))), a));
+
+    // XOR of an expression with a single byte keeps the last-byte semantics
+    const ByteArray with_byte = (a ^ b) ^ static_cast<unsigned char>(0x01);
+    assert(with_byte == (eager_xor(a, b) ^ static_cast<unsigned char>(0x01)));
+
+    // the complement of an empty operand still throws
+    const ByteArray empty;
+    bool threw = false;
+    try {
+        const ByteArray result = a ^ ~empty ^ b;
+        (void)result;
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    PRINT_PASSED();
+}
+
 // Test iterator range constructor
 void test_iterator_range_constructor() {
     // Test with std::vector
@@ -797,6 +1627,721 @@ void test_create_from_prng() {
     assert(exception_thrown);
 }
 
+void test_secure_equals() {
+    // lengths around the vector widths so every kernel tail is exercised
+    for (const size_t size : {0, 1, 7, 8, 15, 16, 31, 32, 63, 64, 65, 127, 128, 200}) {
+        const ByteArray a = patterned(size, 3);
+        ByteArray b = a;
+        assert(secure_equals(a, b));
+        assert(a == b);
+
+        // a single flipped bit anywhere is detected
+        for (size_t i = 0; i < size; ++i) {
+            b.at(i) ^= 0x01;
+            assert(!secure_equals(a, b));
+            assert(!(a == b));
+            b.at(i) ^= 0x01;
+        }
+    }
+
+    // the size is compared first
+    assert(!secure_equals(ByteArray("0011"), ByteArray("001100")));
+    assert(secure_equals(ByteView(), ByteArray()));
+
+    // views, vectors and fixed arrays are accepted like in operator==
+    const std::vector<unsigned char> vec = {0xde, 0xad, 0xbe, 0xef};
+    const FixedByteArray<4> fixed("deadbeef");
+    assert(secure_equals(vec, ByteArray("deadbeef")));
+    assert(secure_equals(ByteView(fixed), ByteView(vec)));
+    assert(secure_equals(ByteView(vec).subview(1, 2), ByteArray("adbe")));
+
+    // erase verification runs across the full capacity of heap backed arrays
+    ByteArray large = patterned(1000, 9);
+    assert(large.secure_wipe());
+    assert(large.empty());
+
+    PRINT_PASSED();
+}
+
+void test_wipe_policy() {
+    ByteArray key = patterned(200, 5);
+    assert(key.wipe_policy() == SecureWipePolicy{});
+    assert(key.wipe_policy().verify && !key.wipe_policy().multi_pass);
+
+    // unverified and multi-pass wipes still leave every block zeroed when it is freed
+    ZeroCheckingResource checking;
+    for (const SecureWipePolicy policy : {SecureWipePolicy{false, false}, SecureWipePolicy{true, true},
+                                          SecureWipePolicy{false, true}}) {
+        ByteArray pooled(&checking);
+        pooled.concat(patterned(300, 11));
+        pooled.set_wipe_policy(policy);
+        assert(pooled.secure_wipe());
+        assert(pooled.empty());
+        // the policy survives the wipe
+        assert(pooled.wipe_policy() == policy);
+    }
+    assert(checking.deallocations == 3);
+    assert(checking.dirty_deallocations == 0);
+
+    // the policy travels with copies and moves
+    key.set_wipe_policy({.verify = false, .multi_pass = true});
+    const ByteArray copy = key;
+    assert(copy.wipe_policy() == key.wipe_policy());
+    ByteArray moved(std::move(key));
+    assert(moved.wipe_policy().multi_pass);
+    ByteArray assigned;
+    assigned = std::move(moved);
+    assert(assigned.wipe_policy().multi_pass && !assigned.wipe_policy().verify);
+
+    // a multi-pass policy adds an explicit erase in front of the secure resource's own
+    ZeroCheckingResource upstream;
+    SecureMemoryResource secure(&upstream);
+    {
+        ByteArray secret(&secure);
+        secret.concat(patterned(100, 2));
+        secret.set_wipe_policy({.verify = true, .multi_pass = true});
+        assert(secret.secure_wipe());
+    }
+    assert(upstream.dirty_deallocations == 0);
+    assert(secure.live_blocks() == 0);
+
+    // clear() wipes through the policy too
+    ByteArray cleared = patterned(64, 1);
+    cleared.set_wipe_policy({.verify = false});
+    cleared.clear();
+    assert(cleared.empty());
+
+    PRINT_PASSED();
+}
+
+void test_byte_chain() {
+    const ByteArray header("0102");
+    const std::vector<unsigned char> payload = [] { const ByteArray p = patterned(100, 3); return std::vector<unsigned char>(p.begin(), p.end()); }();
+    ByteChain frame;
+    frame.append(header).append(payload).append(ByteArray("aabbcc"));
+    assert(frame.segment_count() == 3);
+    assert(frame.size() == 2 + payload.size() + 3);
+
+    const ByteArray expected = ByteArray::concat_and_create({header, ByteArray(payload), ByteArray("aabbcc")});
+    assert(frame.flatten() == expected);
+    assert(frame == ByteView(expected));
+    assert(!(frame == ByteView(expected).first(10)));
+    assert(frame.at(0) == 0x01 && frame.at(2) == payload[0] && frame.at(frame.size() - 1) == 0xcc);
+    bool thrown = false;
+    try {
+        (void)frame.at(frame.size());
+    } catch (const std::out_of_range&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // borrowed segments are views, owned ones survive their source
+    assert(frame.segment(0).data() == header.data());
+    assert(frame.segment(1).data() == payload.data());
+    ByteChain copy;
+    {
+        auto shared = std::make_shared<const ByteArray>(patterned(50, 9));
+        copy.append(shared).append(frame);
+    }
+    assert(copy.size() == 50 + frame.size());
+    assert(copy.flatten() == ByteArray::concat_and_create({patterned(50, 9), expected}));
+    // empty segments are skipped
+    copy.append(ByteView()).append(ByteArray());
+    assert(copy.segment_count() == 4);
+
+    // per segment XOR and complement match the flattened array, also for unequal lengths
+    for (const size_t other_size : {size_t{0}, size_t{1}, size_t{50}, frame.size(), frame.size() + 17}) {
+        const ByteArray other = patterned(other_size, 21);
+        ByteArray out;
+        frame.xor_into(other, out);
+        assert(out == ByteArray(expected ^ other));
+    }
+    ByteArray inverted;
+    frame.complement_into(inverted);
+    assert(inverted == ByteArray(~expected));
+    thrown = false;
+    try {
+        ByteChain().complement_into(inverted);
+    } catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // out may be one of the segments
+    ByteArray in_place = patterned(40, 1);
+    ByteChain self;
+    self.append(in_place).append(ByteArray("ff"));
+    self.flatten_into(in_place);
+    assert(in_place.size() == 41 && ByteView(in_place).first(40) == patterned(40, 1));
+    ByteChain doubled;
+    doubled.append(ByteArray("0102")).append(doubled);
+    assert(doubled.flatten() == ByteArray("01020102"));
+    doubled.append(doubled);
+    assert(doubled.size() == 8 && doubled.segment_count() == 4);
+
+    // flatten_into reuses the capacity of its output
+    ByteArray reused = ByteArray::create_with_prealloc(1024);
+    const unsigned char* block = reused.data();
+    frame.flatten_into(reused);
+    assert(reused.data() == block && reused == expected);
+
+#if defined(JLBA_HAS_WRITEV)
+    int fds[2];
+    assert(pipe(fds) == 0);
+    assert(frame.write_to(fds[1]) == frame.size());
+    close(fds[1]);
+    std::vector<unsigned char> received(frame.size() + 1);
+    size_t got = 0;
+    ssize_t n;
+    while ((n = read(fds[0], received.data() + got, received.size() - got)) > 0) got += static_cast<size_t>(n);
+    close(fds[0]);
+    assert(got == frame.size());
+    received.resize(got);
+    assert(ByteView(received) == expected);
+#endif
+
+    // concat_and_create sizes its result exactly
+    const size_t joined_size = ByteArray::INLINE_CAPACITY + 68;
+    const ByteArray joined = ByteArray::concat_and_create({patterned(40, 1), patterned(joined_size - 40, 2)});
+    assert(joined.size() == joined_size && joined.capacity() == joined_size);
+
+    PRINT_PASSED();
+}
+
+void test_xor_stream() {
+    const ByteArray data = patterned(5000, 17);
+    const ByteArray key("0123456789abcdef0f");
+
+    // chunked processing continues the key across chunk boundaries, also with a tiny block size
+    for (const size_t block_size : {size_t{1}, size_t{7}, size_t{64}, XorStream::default_block_size}) {
+        XorStream stream = XorStream::repeating(key, block_size);
+        assert(stream.block_size() % key.size() == 0);
+        ByteArray out;
+        ByteArray result;
+        size_t offset = 0;
+        for (const size_t chunk : {0, 1, 3, 100, 1000, 2500, 1396}) {
+            stream.update(ByteView(data).subview(offset, chunk), out);
+            assert(out.size() == chunk);
+            result.concat(out);
+            offset += chunk;
+        }
+        assert(offset == data.size() && stream.position() == data.size());
+        for (size_t i = 0; i < data.size(); ++i) {
+            assert(result[i] == (data[i] ^ key[i % key.size()]));
+        }
+    }
+
+    // a keystream as long as the data gives the same bytes as the in-memory operator^
+    const ByteArray pad = patterned(data.size(), 99);
+    ByteArray streamed;
+    XorStream::repeating(pad).update(data, streamed);
+    assert(streamed == ByteArray(data ^ pad));
+
+    // generated keystream: chunking does not change the output
+    std::array<unsigned char, 32> seed{};
+    seed[5] = 0x11;
+    random::ChaCha20Drbg drbg_whole(seed);
+    random::ChaCha20Drbg drbg_chunked(seed);
+    XorStream whole([&](unsigned char* out, const size_t n) { drbg_whole.fill(out, n); }, 256);
+    XorStream chunked([&](unsigned char* out, const size_t n) { drbg_chunked.fill(out, n); }, 256);
+    ByteArray whole_out;
+    whole.update(data, whole_out);
+    ByteArray chunked_out;
+    ByteArray piece;
+    for (size_t offset = 0; offset < data.size(); offset += 333) {
+        chunked.update(ByteView(data).subview(offset, 333), piece);
+        chunked_out.concat(piece);
+    }
+    assert(chunked_out == whole_out);
+    assert(whole_out != data);
+
+    // complement, in place
+    ByteArray in_place = data;
+    XorStream inverter = XorStream::complement();
+    inverter.update(in_place, in_place);
+    assert(in_place == ByteArray(~data));
+
+    // standard streams
+    std::istringstream input(std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+    std::ostringstream output;
+    XorStream file_stream = XorStream::repeating(key, 1000);
+    assert(file_stream.process(input, output) == data.size());
+    const std::string written = output.str();
+    assert(written.size() == data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        assert(static_cast<unsigned char>(written[i]) == (data[i] ^ key[i % key.size()]));
+    }
+
+    // invalid configurations
+    size_t failures = 0;
+    try { (void)XorStream::repeating(ByteView()); } catch (const std::invalid_argument&) { ++failures; }
+    try { (void)XorStream::repeating(key, 0); } catch (const std::invalid_argument&) { ++failures; }
+    try { XorStream bad{XorStream::KeystreamSource()}; } catch (const std::invalid_argument&) { ++failures; }
+    assert(failures == 3);
+
+    PRINT_PASSED();
+}
+void test_mapped_byte_array() {
+    const auto dir = std::filesystem::temp_directory_path();
+    const auto path = dir / "byteao_mapped_test.bin";
+    const auto empty_path = dir / "byteao_mapped_empty_test.bin";
+    const ByteArray contents = patterned(10000, 9);
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+        std::ofstream empty_file(empty_path, std::ios::binary);
+    }
+
+    // read-only: the ByteView operations run on the mapped pages
+    {
+        const MappedByteArray mapped(path);
+        assert(mapped.size() == contents.size());
+        assert(mapped.mode() == EMapMode::READ_ONLY && !mapped.is_writable());
+        assert(contents == ByteView(mapped));
+        assert(secure_equals(mapped, contents));
+        assert(mapped.view().first(4).as_hex_string() == contents.as_hex_string().substr(0, 8));
+        assert(mapped.as_hex_string() == contents.as_hex_string());
+        const ByteArray key(ByteView(contents).first(16));
+        assert(ByteArray(mapped ^ key) == ByteArray(contents ^ key));
+        assert(ByteArray(~ByteView(mapped)) == ByteArray(~contents));
+        assert(mapped.to_byte_array() == contents);
+    }
+    {
+        MappedByteArray mapped(path);
+        bool threw = false;
+        try { (void)mapped.mutable_data(); } catch (const std::logic_error&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { mapped.secure_wipe(); } catch (const std::logic_error&) { threw = true; }
+        assert(threw && mapped.size() == contents.size());
+        mapped.reset();
+        assert(mapped.empty() && mapped.data() == nullptr);
+    }
+
+    // copy-on-write: writes and the wipe only touch private pages, never the file
+    {
+        MappedByteArray mapped(path, EMapMode::COPY_ON_WRITE);
+        mapped[0] ^= 0xFF;
+        mapped.mutable_data()[9999] = 0x42;
+        assert(mapped[0] == static_cast<unsigned char>(contents[0] ^ 0xFF) && mapped[9999] == 0x42);
+        assert(MappedByteArray(path).view() == ByteView(contents));
+
+        MappedByteArray moved(std::move(mapped));
+        assert(mapped.empty() && moved.size() == contents.size() && moved.is_writable());
+        assert(moved.secure_wipe());
+        assert(moved.empty());
+        assert(MappedByteArray(path).view() == ByteView(contents));
+    }
+
+    // empty files map to an empty array, missing files throw
+    {
+        MappedByteArray mapped(empty_path, EMapMode::COPY_ON_WRITE);
+        assert(mapped.empty() && mapped.view().empty());
+        assert(mapped.secure_wipe());
+        bool threw = false;
+        try { MappedByteArray missing(dir / "byteao_mapped_does_not_exist.bin"); } catch (const std::system_error& e) {
+            threw = e.code() == std::errc::no_such_file_or_directory;
+        }
+        assert(threw);
+    }
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(empty_path);
+    PRINT_PASSED();
+}
+// Run the bulk operations through the worker pool with a tiny threshold and odd chunk size
+void test_parallel_ops() {
+    const parallel::Config saved = parallel::config();
+    assert(parallel::thread_count() >= 1);
+    // four threads even on a single core machine so the pool is exercised everywhere,
+    // builds without the pool (BYTEAO_ENABLE_PARALLEL=OFF) always report one
+    parallel::set_config({.threshold = 4096, .chunk_size = 1000, .max_threads = 4});
+    assert(parallel::thread_count() == 4 || parallel::thread_count() == 1);
+
+    for (const size_t size : {size_t{4095}, size_t{4096}, size_t{100003}}) {
+        const ByteArray a = patterned(size, 3);
+        const ByteArray b = patterned(size, 11);
+        ByteArray expected_xor(size, 0x00);
+        ByteArray expected_not(size, 0x00);
+        for (size_t i = 0; i < size; ++i) {
+            expected_xor.at(i) = a[i] ^ b[i];
+            expected_not.at(i) = static_cast<unsigned char>(~a[i]);
+        }
+
+        ByteArray out;
+        ByteArray::xor_into(a, b, out);
+        assert(out == expected_xor);
+        ByteArray in_place = a;
+        in_place ^= b;
+        assert(in_place == expected_xor);
+        ByteArray::complement_into(a, out);
+        assert(out == expected_not);
+
+        ByteChain chain;
+        chain.append(ByteView(a).first(size / 3)).append(ByteView(a).subview(size / 3));
+        chain.xor_into(b, out);
+        assert(out == expected_xor);
+
+        // equality, differences in the first and in the last chunk
+        ByteArray copy = a;
+        assert(copy == a && secure_equals(copy, a));
+        copy.at(0) ^= 0x01;
+        assert(!(copy == a) && !secure_equals(copy, a));
+        copy.at(0) ^= 0x01;
+        copy.at(size - 1) ^= 0x80;
+        assert(!(copy == a) && !secure_equals(copy, a));
+    }
+
+    // operator== reaches the library path from parallel_compare_floor on
+    {
+        const ByteArray big = patterned(detail::parallel_compare_floor + 17, 5);
+        ByteArray other = big;
+        assert(big == other);
+        other.at(detail::parallel_compare_floor) ^= 0x10;
+        assert(!(big == other));
+    }
+
+    // the chunked wipe covers the whole block, also with the multi-pass policy
+    for (const bool multi_pass : {false, true}) {
+        ZeroCheckingResource upstream;
+        ByteArray secret(&upstream);
+        secret.concat(patterned(50001, 7));
+        secret.set_wipe_policy({.verify = true, .multi_pass = multi_pass});
+        assert(secret.secure_wipe());
+        assert(upstream.deallocations > 0 && upstream.dirty_deallocations == 0);
+    }
+
+    parallel::set_config({.max_threads = 1});
+    assert(parallel::thread_count() == 1);
+    ByteArray single;
+    ByteArray::xor_into(patterned(1 << 20, 1), patterned(1 << 20, 2), single);
+    assert(single.size() == 1 << 20);
+
+    bool threw = false;
+    try { parallel::set_config({.chunk_size = 0}); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+
+    parallel::set_config(saved);
+    assert(parallel::config() == saved);
+    PRINT_PASSED();
+}
+void test_byte_array_batch() {
+    // span batches: same results as operator^ per element
+    {
+        const std::vector<ByteArray> left = {patterned(3, 1), patterned(40, 2), ByteArray(), patterned(100, 3)};
+        const std::vector<ByteArray> right = {patterned(5, 4), patterned(40, 5), patterned(2, 6), patterned(1, 7)};
+        const std::vector<ByteView> a(left.begin(), left.end());
+        const std::vector<ByteView> b(right.begin(), right.end());
+        std::vector<ByteArray> out(a.size());
+        ByteArray::xor_batch(a, b, out);
+        for (size_t i = 0; i < a.size(); ++i) {
+            assert(out[i] == ByteArray(a[i] ^ b[i]));
+        }
+
+        const ByteArray key("a1b2c3");
+        ByteArray::xor_batch(a, key, out);
+        for (size_t i = 0; i < a.size(); ++i) {
+            assert(out[i] == ByteArray(a[i] ^ key));
+        }
+
+        bool threw = false;
+        try { ByteArray::xor_batch(a, std::span(b).first(2), out); } catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+    }
+
+    // fixed length records, including record sizes that do not divide the key pattern or the parallel chunks
+    const parallel::Config saved = parallel::config();
+    for (const bool parallel_run : {false, true}) {
+        if (parallel_run) parallel::set_config({.threshold = 4096, .chunk_size = 1000, .max_threads = 4});
+        for (const size_t record_size : {size_t{1}, size_t{3}, size_t{16}, size_t{33}, size_t{5000}}) {
+            const size_t count = 300;
+            ByteArrayBatch records(record_size);
+            ByteArrayBatch others(record_size);
+            records.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                records.push_back(patterned(record_size, static_cast<unsigned char>(i)));
+                others.push_back(patterned(record_size, static_cast<unsigned char>(i + 101)));
+            }
+            assert(records.size() == count && records.record_size() == record_size);
+            assert(records.view().size() == count * record_size);
+            const ByteArray key = patterned(record_size, 77);
+
+            ByteArrayBatch masked;
+            ByteArrayBatch::xor_into(records, key, masked);
+            ByteArrayBatch pairwise;
+            ByteArrayBatch::xor_into(records, others, pairwise);
+            ByteArrayBatch inverted;
+            ByteArrayBatch::complement_into(records, inverted);
+            assert(masked.size() == count && masked.record_size() == record_size);
+            for (size_t i = 0; i < count; ++i) {
+                assert(masked[i] == ByteView(ByteArray(records[i] ^ key)));
+                assert(pairwise[i] == ByteView(ByteArray(records[i] ^ others[i])));
+                assert(inverted[i] == ByteView(ByteArray(~records[i])));
+            }
+
+            // in place, XORing twice restores the records
+            ByteArrayBatch copy = records;
+            copy ^= key;
+            assert(copy == masked);
+            copy ^= key;
+            assert(copy == records);
+            copy ^= others;
+            assert(copy == pairwise);
+        }
+        parallel::set_config(saved);
+    }
+
+    // shape checks, element access, growth and wipe
+    {
+        ByteArrayBatch batch(4, 2);
+        assert(batch.size() == 2 && batch[1] == ByteView(ByteArray(4, 0x00)));
+        batch.record(1)[3] = 0x7F;
+        assert(batch.at(1)[3] == 0x7F);
+        batch.push_back(batch[1]);
+        assert(batch.size() == 3 && batch[2][3] == 0x7F);
+        batch.resize(5);
+        assert(batch.size() == 5 && batch[4] == ByteView(ByteArray(4, 0x00)));
+
+        bool threw = false;
+        try { (void)batch.at(5); } catch (const std::out_of_range&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { batch.push_back(ByteArray(3, 0x01)); } catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { batch ^= ByteArray(5, 0x01); } catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { batch ^= ByteArrayBatch(4, 4); } catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { ByteArrayBatch invalid(0); } catch (const std::invalid_argument&) { threw = true; }
+        assert(threw);
+        // record counts whose byte size does not fit size_t are rejected instead of wrapping
+        const size_t huge_count = std::numeric_limits<size_t>::max() / 2;
+        threw = false;
+        try { ByteArrayBatch overflowing(16, huge_count); } catch (const std::length_error&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { batch.reserve(huge_count); } catch (const std::length_error&) { threw = true; }
+        assert(threw);
+        threw = false;
+        try { batch.resize(huge_count); } catch (const std::length_error&) { threw = true; }
+        assert(threw && batch.size() == 5);
+
+        ZeroCheckingResource upstream;
+        ByteArrayBatch secret(64, 0, &upstream);
+        // reserved up front, growth would leave unwiped blocks behind as with ByteArray
+        secret.reserve(10);
+        for (int i = 0; i < 10; ++i) secret.push_back(patterned(64, static_cast<unsigned char>(i)));
+        assert(secret.get_allocator().resource() == &upstream);
+        assert(secret.secure_wipe());
+        assert(secret.empty() && secret.record_size() == 64);
+        assert(upstream.deallocations == 1 && upstream.dirty_deallocations == 0);
+    }
+    PRINT_PASSED();
+}
+void test_stats() {
+    if (!stats::enabled()) {
+        // nothing is counted without BYTEAO_ENABLE_STATS
+        ByteArray unused(1000, 0x01);
+        assert(stats::snapshot() == stats::Counters{} && stats::thread_snapshot() == stats::Counters{});
+        PRINT_PASSED();
+        return;
+    }
+
+    const stats::Counters before = stats::thread_snapshot();
+    {
+        ByteArray big(1000, 0x01);
+        const ByteArray copy = big;
+        ByteArray grown(100, 0x02);
+        grown.concat(ByteArray(200, 0x03));
+        assert(big.secure_wipe());
+    }
+    const stats::Counters cost = stats::thread_snapshot() - before;
+    // big, copy, grown's first block, its larger block and the concatenated operand
+    assert(cost.allocations == 5 && cost.deallocations == 5);
+    assert(cost.allocated_bytes >= 2500);
+    assert(cost.reallocations == 1);
+    assert(cost.copies >= 1 && cost.bytes_copied >= 1000 + 300);
+    assert(cost.wipes >= 1 && cost.bytes_wiped >= 1000);
+    assert(cost.verify_failures == 0);
+
+    // other threads count into their own block, snapshot() sums them even after they exit
+    const stats::Counters global_before = stats::snapshot();
+    const stats::Counters thread_before = stats::thread_snapshot();
+    std::thread worker([] { ByteArray remote(5000, 0x04); });
+    worker.join();
+    assert(stats::thread_snapshot() == thread_before);
+    const stats::Counters global_cost = stats::snapshot() - global_before;
+    assert(global_cost.allocations >= 1 && global_cost.allocated_bytes >= 5000);
+
+    stats::reset();
+    assert(stats::thread_snapshot() == stats::Counters{});
+
+    // reset() leaves running threads' counters alone and restarts them from a baseline
+    std::atomic<int> step{0};
+    std::thread counting([&step] {
+        for (int i = 0; i < 3; ++i) ByteArray before_reset(5000, 0x05);
+        step = 1;
+        while (step.load() != 2) std::this_thread::yield();
+        for (int i = 0; i < 2; ++i) ByteArray after_reset(5000, 0x06);
+        step = 3;
+        while (step.load() != 4) std::this_thread::yield();
+    });
+    while (step.load() != 1) std::this_thread::yield();
+    stats::reset();
+    const stats::Counters after_reset = stats::snapshot();
+    assert(after_reset.allocations == 0);
+    step = 2;
+    while (step.load() != 3) std::this_thread::yield();
+    const stats::Counters counted = stats::snapshot();
+    assert(counted.allocations == 2 && counted.deallocations == 2);
+    step = 4;
+    counting.join();
+    assert(stats::snapshot().allocations == 2);
+    PRINT_PASSED();
+}
+// Operators on temporaries reuse the temporary's storage instead of allocating a result
+void test_rvalue_operators() {
+    // heap sized for any BYTEAO_INLINE_CAPACITY, inline arrays cannot hand over their block
+    const size_t n = ByteArray::INLINE_CAPACITY + 68;
+    const ByteArray b = patterned(n, 2);
+    const ByteArray c = patterned(n, 3);
+
+    ByteArray a = patterned(n, 1);
+    const ByteArray expected_xor(a ^ b);
+    const unsigned char* block = a.data();
+    ByteArray x = std::move(a) ^ b;
+    assert(x == expected_xor && x.data() == block);
+
+    // chains keep working in the same block
+    ByteArray chained = std::move(x) ^ b ^ c;
+    assert(chained == ByteArray(expected_xor ^ b ^ c) && chained.data() == block);
+
+    const ByteArray expected_not(~chained);
+    ByteArray inverted = ~std::move(chained);
+    assert(inverted == expected_not && inverted.data() == block);
+
+    const ByteArray expected_byte = inverted ^ static_cast<unsigned char>(0x5A);
+    ByteArray with_byte = std::move(inverted) ^ static_cast<unsigned char>(0x5A);
+    assert(with_byte == expected_byte && with_byte.data() == block);
+
+    // concat_copy of a temporary appends in place when the capacity allows it
+    ByteArray prefix = ByteArray::create_with_prealloc(3 * n);
+    prefix.concat(b);
+    const unsigned char* prefix_block = prefix.data();
+    ByteArray joined = std::move(prefix).concat_copy(c);
+    assert(joined.size() == 2 * n && joined.data() == prefix_block);
+    assert(ByteView(joined).first(n) == ByteView(b) && ByteView(joined).subview(n) == ByteView(c));
+
+    // a shorter temporary grows like ^= and still yields the right-aligned result
+    ByteArray short_lhs = patterned(10, 4);
+    const ByteArray expected_grown(short_lhs ^ b);
+    assert((std::move(short_lhs) ^ b) == expected_grown);
+
+    // lvalues still produce lazy expressions and leave their operands untouched
+    const ByteArray lhs = patterned(n, 5);
+    const ByteArray lazy = lhs ^ b;
+    assert(lhs == patterned(n, 5) && lazy.data() != lhs.data());
+
+    bool threw = false;
+    try { (void)~ByteArray(); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+
+    // the move-with-resize constructor keeps the block for truncation and in-capacity padding
+    for (const auto dir : {EZeroPadDir::LSB_PAD, EZeroPadDir::MSB_PAD}) {
+        ByteArray source = patterned(n, 6);
+        const ByteArray expected(source, 40, dir);
+        const unsigned char* source_block = source.data();
+        ByteArray truncated(std::move(source), 40, dir);
+        assert(truncated == expected && truncated.data() == source_block);
+        assert(source.empty());
+
+        ByteArray grown = ByteArray::create_with_prealloc(2 * n);
+        grown.concat(patterned(n, 7));
+        const ByteArray expected_padded(grown, n + 30, dir);
+        const unsigned char* grown_block = grown.data();
+        ByteArray padded(std::move(grown), n + 30, dir);
+        assert(padded == expected_padded && padded.data() == grown_block);
+    }
+
+    PRINT_PASSED();
+}
+
+
+
+
+
+
+void test_random_fill() {
+    // RFC 8439 section 2.3.2 block function test vector
+    std::array<unsigned char, 32> key{};
+    for (size_t i = 0; i < key.size(); ++i) key[i] = static_cast<unsigned char>(i);
+    constexpr std::array<unsigned char, 12> nonce = {0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00};
+    std::array<unsigned char, 64> block{};
+    random::detail::chacha20_block(key, 1, nonce, block);
+    assert(ByteView(block).as_hex_string() ==
+           "10f1e7e4d13b5915500fdd1fa32071c4c7d1f4c733c068030422aa9ac3d46c4e"
+           "d2826446079faa0914c2d705d98b02a2b5129cd1de164eb9cbd083e8a2503c4e");
+
+    // seeded generators are deterministic, through both the buffered and the direct path
+    std::array<unsigned char, 32> seed{};
+    seed[0] = 0x42;
+    random::ChaCha20Drbg drbg_a(seed);
+    random::ChaCha20Drbg drbg_b(seed);
+    std::vector<unsigned char> out_a(5000), out_b(5000);
+    size_t offset = 0;
+    for (const size_t chunk : {1, 7, 64, 2048, 1000, 1880}) {
+        drbg_a.fill(out_a.data() + offset, chunk);
+        drbg_b.fill(out_b.data() + offset, chunk);
+        offset += chunk;
+    }
+    assert(offset == out_b.size());
+    assert(out_a == out_b);
+
+    // a different seed gives a different stream, and the stream is not stuck
+    seed[0] = 0x43;
+    random::ChaCha20Drbg drbg_c(seed);
+    std::vector<unsigned char> out_c(out_a.size());
+    offset = 0;
+    for (const size_t chunk : {1, 7, 64, 2048, 1000, 1880}) {
+        drbg_c.fill(out_c.data() + offset, chunk);
+        offset += chunk;
+    }
+    assert(out_a != out_c);
+    assert(!std::equal(out_a.begin(), out_a.begin() + 64, out_a.begin() + 64));
+
+    // fill_random keeps the size and the storage of the target
+    ByteArray buffer(100, 0x00);
+    const unsigned char* storage = buffer.data();
+    ByteArray::fill_random(buffer);
+    assert(buffer.size() == 100);
+    assert(buffer.data() == storage);
+    assert(buffer != ByteArray(100, 0x00));
+
+    const ByteArray before = buffer;
+    ByteArray::fill_random(buffer, ERandomSource::THREAD_DRBG);
+    assert(buffer.data() == storage);
+    assert(buffer != before);
+
+    // fill_random is not bound by MAX_RANDOM_BYTES, an empty target is a no-op
+    ByteArray large(ByteArray::MAX_RANDOM_BYTES + 1, 0x00);
+    ByteArray::fill_random(large, ERandomSource::THREAD_DRBG);
+    assert(large.size() == ByteArray::MAX_RANDOM_BYTES + 1);
+    ByteArray empty;
+    ByteArray::fill_random(empty);
+    assert(empty.empty());
+
+    // both sources produce independent results through the factory
+    const ByteArray nonce1 = ByteArray::create_from_prng(12, ERandomSource::THREAD_DRBG);
+    const ByteArray nonce2 = ByteArray::create_from_prng(12, ERandomSource::THREAD_DRBG);
+    assert(nonce1.size() == 12 && nonce2.size() == 12);
+    assert(nonce1 != nonce2);
+
+    PRINT_PASSED();
+}
+
 void test_partial_copy_constructor() {
     // Test case 1: Copy less bytes than available
     {
@@ -1041,7 +2586,7 @@ void test_resize_growing() {
     assert(array[4] == 0x00);
 }
 
-// Test shrinking with purge and warning enabled
+// Test shrinking with purge and the (ignored) warning flag enabled
 void test_resize_shrink_with_purge_and_warning() {
     ByteArray array = {0x01, 0x02, 0x03, 0x04, 0x05};
     size_t new_size = 3;
@@ -1050,8 +2595,9 @@ void test_resize_shrink_with_purge_and_warning() {
         array.resize(new_size, true, true); // With purge and warning
     });
 
-    // Check if warning was output
-    assert(stderr_output.find("SECURITY WARNING") != std::string::npos);
+    // the truncated tail is erased in place, so nothing is written
+    assert(stderr_output.empty());
+    assert(array.data()[3] == 0x00 && array.data()[4] == 0x00);
 
     // Check new size is correct
     assert(array.size() == new_size);
@@ -1137,9 +2683,80 @@ void test_resize_to_zero() {
     std::cout << "Test resize (to zero): PASSED" << std::endl;
 }
 
+// Test that resize works in place and only wipes what it drops
+void test_resize_in_place() {
+    ByteArray array = patterned(100, 4);
+    const ByteArray original = array;
+    const unsigned char* block = array.data();
+    const size_t capacity = array.capacity();
+
+    // LSB shrink without purge: same block, the tail is left alone
+    array.resize(80, false, false);
+    assert(array.data() == block && array.capacity() == capacity);
+    assert(array == ByteView(original).first(80));
+    assert(block[85] == original[85]);
+
+    // LSB shrink with purge: only the truncated tail is wiped
+    array.resize(60, true, false);
+    assert(array.data() == block);
+    assert(array == ByteView(original).first(60));
+    for (size_t i = 60; i < 80; ++i) assert(block[i] == 0x00);
+
+    // MSB shrink keeps the last bytes and wipes the stale tail
+    array.resize(40, EZeroPadDir::MSB_PAD, true, false);
+    assert(array.data() == block);
+    assert(array == ByteView(original).subview(20, 40));
+    for (size_t i = 40; i < 60; ++i) assert(block[i] == 0x00);
+
+    // growing within the capacity does not reallocate, in either direction
+    array.resize(50, EZeroPadDir::MSB_PAD, true, false);
+    assert(array.data() == block);
+    assert(ByteView(array).first(10) == ByteArray(10, 0x00));
+    assert(ByteView(array).subview(10) == ByteView(original).subview(20, 40));
+    array.resize(capacity);
+    assert(array.data() == block);
+    assert(ByteView(array).subview(50) == ByteArray(capacity - 50, 0x00));
+
+    // growing past the capacity copies once; with purge the abandoned block is zeroed before it is freed
+    // (sized from the inline capacity so the first block is on the heap for any BYTEAO_INLINE_CAPACITY)
+    const size_t heap_size = ByteArray::INLINE_CAPACITY + 32;
+    const size_t grown_size = 4 * heap_size;
+    for (const EZeroPadDir dir : {EZeroPadDir::LSB_PAD, EZeroPadDir::MSB_PAD}) {
+        ZeroCheckingResource checking;
+        ByteArray grown(&checking);
+        grown.concat(patterned(heap_size, 8));
+        grown.resize(grown_size, dir);
+        assert(grown.size() == grown_size);
+        const ByteView kept = dir == EZeroPadDir::MSB_PAD ? ByteView(grown).last(heap_size) : ByteView(grown).first(heap_size);
+        assert(kept == patterned(heap_size, 8));
+        assert(checking.deallocations == 1 && checking.dirty_deallocations == 0);
+        assert(grown.get_allocator().resource() == &checking);
+    }
+
+    // without purge the MSB path still builds the result in a single new block
+    ByteArray msb = patterned(40, 2);
+    msb.resize(500, EZeroPadDir::MSB_PAD, false, false);
+    assert(ByteView(msb).first(460) == ByteArray(460, 0x00));
+    assert(ByteView(msb).last(40) == patterned(40, 2));
+
+    // clear keeps the capacity, and a purging clear erases the whole block
+    ByteArray cleared = patterned(200, 6);
+    const unsigned char* cleared_block = cleared.data();
+    const size_t cleared_capacity = cleared.capacity();
+    cleared.clear(false);
+    assert(cleared.empty() && cleared.capacity() == cleared_capacity);
+    assert(cleared_block[10] == patterned(200, 6)[10]);
+    cleared.clear(true);
+    assert(cleared.empty() && cleared.capacity() == cleared_capacity && cleared.data() == cleared_block);
+    for (size_t i = 0; i < cleared_capacity; ++i) assert(cleared_block[i] == 0x00);
+
+    PRINT_PASSED();
+}
+
 // Main resize test runner
 void test_resize_functionality() {
     test_resize_growing();
+    test_resize_in_place();
     test_resize_shrink_with_purge_and_warning();
     test_resize_shrink_without_purge();
     test_resize_shrink_without_warning();
@@ -1390,12 +3007,69 @@ void test_as_hex_string_from_string() {
 }
 
 // Run all tests for as_hex_string
+// Test hex decoding of upper case digits, invalid characters and a full byte round trip
+void test_hex_codec_round_trip() {
+    const ByteArray upper("DEADBEEF");
+    assert(upper == ByteArray({0xDE, 0xAD, 0xBE, 0xEF}));
+    assert(upper.as_hex_string() == "deadbeef");
+
+    // every byte value survives encode -> decode
+    std::vector<unsigned char> all_bytes(256);
+    for (size_t i = 0; i < all_bytes.size(); ++i) {
+        all_bytes[i] = static_cast<unsigned char>(i);
+    }
+    const ByteArray all(all_bytes);
+    const std::string hex = all.as_hex_string();
+    assert(hex.size() == 512);
+    assert(ByteArray(hex) == all);
+
+    // invalid characters are rejected, including anything strtol used to tolerate
+    for (const std::string_view invalid : {"zz", "0g", " f", "+f", "-1", "0x", "abc!"}) {
+        bool exception_thrown = false;
+        try {
+            const ByteArray parsed(invalid);
+            (void)parsed;
+        } catch (const std::runtime_error&) {
+            exception_thrown = true;
+        }
+        assert(exception_thrown);
+    }
+
+    PRINT_PASSED();
+}
+
+// Test appending hex into caller-owned buffers
+void test_hex_into_caller_buffers() {
+    const ByteArray data({0x01, 0xAB, 0xCD});
+
+    std::string line = "key=";
+    data.append_hex_to(line);
+    assert(line == "key=01abcd");
+    ByteArray().append_hex_to(line);
+    assert(line == "key=01abcd");
+
+    std::array<char, 8> buf{};
+    const auto ok = data.to_hex_chars(buf.data(), buf.data() + buf.size());
+    assert(ok.ec == std::errc{});
+    assert(ok.ptr == buf.data() + 6);
+    assert(std::string_view(buf.data(), 6) == "01abcd");
+
+    std::array<char, 5> small{};
+    const auto too_small = data.to_hex_chars(small.data(), small.data() + small.size());
+    assert(too_small.ec == std::errc::value_too_large);
+    assert(too_small.ptr == small.data() + small.size());
+
+    PRINT_PASSED();
+}
+
 void test_as_hex_string_all() {
     test_as_hex_string_empty();
     test_as_hex_string_zeros();
     test_as_hex_string_padding();
     test_as_hex_string_mixed();
     test_as_hex_string_from_string();
+    test_hex_codec_round_trip();
+    test_hex_into_caller_buffers();
     std::cout << __func__ << " passed!" << std::endl;
 }
 
@@ -1521,15 +3195,13 @@ void test_resize_with_custom_security_options() {
     ba.resize(3, EZeroPadDir::LSB_PAD, false);
     assert(ba == expected);
 
-    // Verify warning output when shrinking with warning enabled
+    // Verify nothing is written when shrinking, whatever the warning flag
     ba = {0x01, 0x02, 0x03, 0x04, 0x05};
     std::string stderr_output = capture_stderr([&]() {
         ba.resize(3, EZeroPadDir::LSB_PAD, true, true);
     });
-    assert(!stderr_output.empty());
-    assert(stderr_output.find("SECURITY WARNING") != std::string::npos);
+    assert(stderr_output.empty());
 
-    // Verify no warning output when warning disabled
     ba = {0x01, 0x02, 0x03, 0x04, 0x05};
     stderr_output = capture_stderr([&]() {
         ba.resize(3, EZeroPadDir::LSB_PAD, true, false);
@@ -1632,26 +3304,471 @@ void run_all_clear_tests() {
 }
 
 // Main test function
+void test_append_and_insert() {
+    ByteArray frame;
+    frame.push_back(0x17);
+    frame.append_integral<uint16_t>(0x0303).append_integral<uint32_t, EByteOrder::LSB_FIRST>(0x01020304);
+    const unsigned char raw[] = {0xAA, 0xBB};
+    frame.append(raw, sizeof(raw)).append(ByteArray({0xCC}));
+    frame.append(nullptr, 0);
+    assert(frame == ByteArray({0x17, 0x03, 0x03, 0x04, 0x03, 0x02, 0x01, 0xAA, 0xBB, 0xCC}));
+
+    // std::back_inserter goes through push_back
+    ByteArray copied;
+    std::copy(frame.begin(), frame.end(), std::back_inserter(copied));
+    assert(copied == frame);
+
+    ByteArray middle({0x01, 0x04});
+    middle.insert(1, ByteArray({0x02, 0x03})).prepend(ByteArray({0x00})).insert(5, ByteArray({0x05}));
+    assert(middle == ByteArray({0x00, 0x01, 0x02, 0x03, 0x04, 0x05}));
+
+    // inserting (a part of) the array into itself, both within the capacity and past it
+    ByteArray self({0x01, 0x02, 0x03});
+    self.insert(1, ByteView(self).last(2));
+    assert(self == ByteArray({0x01, 0x02, 0x03, 0x02, 0x03}));
+    ByteArray big = patterned(100, 1);
+    big.prepend(big);
+    assert(ByteView(big).first(100) == ByteView(patterned(100, 1)) && ByteView(big).last(100) == ByteView(patterned(100, 1)));
+
+    bool threw = false;
+    try { middle.insert(7, ByteArray({0x00})); } catch (const std::out_of_range&) { threw = true; }
+    assert(threw);
+
+    // appends within a reserved capacity keep the block
+    ByteArray reserved;
+    reserved.reserve(256);
+    const unsigned char* block = reserved.data();
+    for (size_t i = 0; i < 256; ++i) reserved.push_back(static_cast<unsigned char>(i));
+    assert(reserved.size() == 256 && reserved.data() == block && reserved[255] == 0xFF);
+
+    PRINT_PASSED();
+}
+
+void test_byte_writer() {
+    const ByteArray payload = patterned(1000, 3);
+
+    ByteArray frame = ByteArray::create_with_prealloc(1500);
+    const unsigned char* block = frame.data();
+    {
+        ByteWriter writer(frame);
+        assert(writer.remaining() == frame.capacity() && writer.written() == 0);
+        writer.put(0x17).write_integral<uint16_t>(0x0303).write_integral<uint16_t>(static_cast<uint16_t>(payload.size()));
+        writer.write(payload).fill(3, 0xEE);
+        assert(writer.written() == 1008);
+        // nothing is visible before the flush
+        assert(frame.empty());
+        writer.flush();
+        assert(frame.size() == 1008);
+    }
+    assert(frame.size() == 1008 && frame.data() == block);
+    assert(ByteView(frame).first(5) == ByteView(ByteArray({0x17, 0x03, 0x03, 0x03, 0xE8})));
+    assert(ByteView(frame).subview(5, 1000) == ByteView(payload));
+    assert(ByteView(frame).last(3) == ByteView(ByteArray({0xEE, 0xEE, 0xEE})));
+
+    // writing continues after the existing contents and grows past the capacity
+    ByteArray grown({0x01});
+    {
+        ByteWriter writer(grown);
+        for (size_t i = 0; i < 1000; ++i) writer.write_integral<uint32_t, EByteOrder::LSB_FIRST>(static_cast<uint32_t>(i));
+        writer.write(payload);
+        assert(writer.written() == 5000);
+    }
+    assert(grown.size() == 5001 && grown[0] == 0x01);
+    assert((ByteView(grown).subview(1, 4).as_integral<uint32_t, EByteOrder::LSB_FIRST>() == 0));
+    assert((ByteView(grown).subview(1 + 999 * 4, 4).as_integral<uint32_t, EByteOrder::LSB_FIRST>() == 999));
+    assert(ByteView(grown).last(1000) == ByteView(payload));
+
+    // a source inside the target's block survives the reallocation
+    ByteArray self = patterned(40, 5);
+    {
+        ByteWriter writer(self);
+        writer.flush();
+        writer.write(ByteView(self));
+    }
+    assert(self.size() == 80 && ByteView(self).first(40) == ByteView(self).last(40));
+
+    PRINT_PASSED();
+}
+
+void test_byte_reader() {
+    const ByteArray packet({0x17, 0x03, 0x03, 0x00, 0x03, 0xAA, 0xBB, 0xCC, 0x04, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0xFF});
+    ByteReader reader(packet);
+    assert(reader.remaining() == 16 && !reader.empty());
+    const unsigned char type = reader.read_u8();
+    const auto peeked = reader.peek_integral<uint16_t>();
+    const auto version = reader.read_integral<uint16_t>();
+    assert(type == 0x17 && peeked == 0x0303 && version == 0x0303);
+
+    // slices are views into the input, nothing is copied
+    const ByteView body = reader.read_prefixed<uint16_t>();
+    assert(body.size() == 3 && body.data() == packet.data() + 5);
+    const auto little = reader.read_integral<uint32_t, EByteOrder::LSB_FIRST>();
+    const auto partial = reader.read_integral(3);
+    assert(little == 0x01020304 && partial == 0x010203);
+    assert(reader.position() == 15 && reader.rest().size() == 1);
+
+    // failed reads throw and consume nothing
+    bool threw = false;
+    try { (void)reader.read_integral<uint16_t>(); } catch (const std::out_of_range&) { threw = true; }
+    assert(threw && reader.position() == 15);
+    threw = false;
+    try { (void)reader.read_integral<uint16_t>(3); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    const unsigned char last = reader.read_u8();
+    assert(last == 0xFF && reader.empty());
+
+    // a length prefix running past the end leaves the prefix unread
+    const ByteArray truncated({0x05, 0x01, 0x02});
+    ByteReader short_reader(truncated);
+    threw = false;
+    try { (void)short_reader.read_prefixed<uint8_t>(); } catch (const std::out_of_range&) { threw = true; }
+    assert(threw && short_reader.position() == 0);
+
+    // a 64-bit length near the maximum is reported as read, not wrapped around with the prefix size
+    ByteArray huge_prefix(8, 0xFF);
+    huge_prefix.push_back(0x00);
+    ByteReader huge_reader(huge_prefix);
+    std::string message;
+    try { (void)huge_reader.read_prefixed<uint64_t>(); } catch (const std::out_of_range& e) { message = e.what(); }
+    assert(message.find("8 + 18446744073709551615 bytes") != std::string::npos && huge_reader.position() == 0);
+
+    // nested readers, skip and seek
+    ByteReader outer(packet);
+    outer.skip(5);
+    ByteReader inner = outer.read_reader(3);
+    assert(inner.remaining() == 3 && outer.position() == 8);
+    const ByteView nested = inner.read_bytes(2);
+    assert(nested == ByteView(ByteArray({0xAA, 0xBB})));
+    outer.seek(0);
+    const unsigned char first = outer.read_u8();
+    assert(first == 0x17);
+    threw = false;
+    try { outer.seek(17); } catch (const std::out_of_range&) { threw = true; }
+    assert(threw && outer.position() == 1);
+
+    // round trip with ByteWriter
+    ByteArray frame;
+    {
+        ByteWriter writer(frame);
+        writer.write_integral<uint64_t>(0x0102030405060708ULL).write_integral<uint16_t, EByteOrder::LSB_FIRST>(0xBEEF);
+    }
+    ByteReader frame_reader(frame);
+    const auto word = frame_reader.read_integral<uint64_t>();
+    const auto tag = frame_reader.read_integral<uint16_t, EByteOrder::LSB_FIRST>();
+    assert(word == 0x0102030405060708ULL && tag == 0xBEEF);
+    assert(frame_reader.empty() && ByteReader().empty());
+
+    PRINT_PASSED();
+}
+
+// bit j of a big-endian bit string, bit 0 is the most significant bit of byte 0
+bool big_endian_bit(const ByteView bytes, const size_t j) {
+    return (bytes[j / 8] >> (7 - j % 8)) & 1;
+}
+
+// reference shift/rotate one bit at a time: source(j) gives the input bit that lands on bit j,
+// or npos for a zero bit
+template <typename Source>
+ByteArray move_bits(const ByteView input, Source&& source) {
+    ByteArray result(input.size(), 0x00);
+    for (size_t j = 0; j < input.size() * 8; ++j) {
+        const size_t from = source(j);
+        if (from != ByteView::npos && big_endian_bit(input, from)) {
+            result.at(j / 8) = static_cast<unsigned char>(result[j / 8] | (0x80 >> (j % 8)));
+        }
+    }
+    return result;
+}
+
+void test_bitwise_ops() {
+    // right-aligned like XOR: the shorter operand is zero-padded on the left
+    const ByteArray wide({0xF0, 0x0F, 0xAA});
+    const ByteArray narrow({0x3C, 0xC3});
+    assert((wide & narrow) == ByteArray({0x00, 0x0C, 0x82}));
+    assert((narrow & wide) == ByteArray({0x00, 0x0C, 0x82}));
+    assert((wide | narrow) == ByteArray({0xF0, 0x3F, 0xEB}));
+    ByteArray cleared = wide;
+    cleared.andnot_assign(narrow);
+    assert(cleared == ByteArray({0xF0, 0x03, 0x28}));
+    ByteArray grown = narrow;
+    grown.andnot_assign(wide);
+    assert(grown == ByteArray({0x00, 0x30, 0x41}));
+    ByteArray masked = narrow;
+    masked &= wide;
+    assert(masked == ByteArray({0x00, 0x0C, 0x82}));
+
+    // every size across the vector widths and tails against byte-wise references
+    for (const size_t size : {size_t{0}, size_t{1}, size_t{15}, size_t{16}, size_t{17}, size_t{33}, size_t{64},
+                              size_t{65}, size_t{127}, size_t{200}}) {
+        const ByteArray a = patterned(size, 3);
+        const ByteArray b = patterned(size, 101);
+        ByteArray expected_and(size, 0x00);
+        ByteArray expected_or(size, 0x00);
+        ByteArray expected_andnot(size, 0x00);
+        uint64_t expected_popcount = 0;
+        uint64_t expected_distance = 0;
+        for (size_t i = 0; i < size; ++i) {
+            expected_and.at(i) = a[i] & b[i];
+            expected_or.at(i) = a[i] | b[i];
+            expected_andnot.at(i) = static_cast<unsigned char>(a[i] & ~b[i]);
+            for (int bit = 0; bit < 8; ++bit) {
+                expected_popcount += (a[i] >> bit) & 1;
+                expected_distance += ((a[i] ^ b[i]) >> bit) & 1;
+            }
+        }
+
+        ByteArray out;
+        ByteArray::and_into(a, b, out);
+        assert(out == expected_and);
+        ByteArray::or_into(a, b, out);
+        assert(out == expected_or);
+        ByteArray::andnot_into(a, b, out);
+        assert(out == expected_andnot);
+        assert(popcount(a) == expected_popcount);
+        assert(hamming_distance(a, b) == expected_distance);
+
+        // in place against the output itself
+        out = a;
+        ByteArray::andnot_into(out, b, out);
+        assert(out == expected_andnot);
+        out = a;
+        out |= out;
+        assert(out == a);
+
+        for (const size_t shift : {size_t{0}, size_t{1}, size_t{3}, size_t{7}, size_t{8}, size_t{9}, size_t{61},
+                                   size * 8 - 1, size * 8, size * 8 + 5}) {
+            const size_t bits = size * 8;
+            const ByteArray expected_left = move_bits(a, [&](const size_t j) {
+                return j + shift < bits ? j + shift : ByteView::npos;
+            });
+            const ByteArray expected_right = move_bits(a, [&](const size_t j) {
+                return j >= shift ? j - shift : ByteView::npos;
+            });
+            assert((a << shift) == expected_left);
+            assert((a >> shift) == expected_right);
+            ByteArray shifted = a;
+            shifted <<= shift;
+            assert(shifted == expected_left);
+            shifted = a;
+            shifted >>= shift;
+            assert(shifted == expected_right);
+            ByteArray::shift_left_into(a, shift, out);
+            assert(out == expected_left);
+            ByteArray::shift_right_into(out, 0, out);
+            assert(out == expected_left);
+
+            if (size == 0) continue;
+            const ByteArray expected_rotl = move_bits(a, [&](const size_t j) { return (j + shift) % bits; });
+            ByteArray rotated = a;
+            rotated.rotate_left(shift);
+            assert(rotated == expected_rotl);
+            rotated.rotate_right(shift);
+            assert(rotated == a);
+        }
+    }
+
+    // temporaries are evaluated in their own storage
+    ByteArray temp = patterned(ByteArray::INLINE_CAPACITY + 68, 1);
+    const unsigned char* block = temp.data();
+    ByteArray reused = (std::move(temp) & patterned(ByteArray::INLINE_CAPACITY + 68, 2)) << 12;
+    assert(reused.data() == block);
+
+    // views into the same array are copied before the in place kernels run over them
+    ByteArray overlapping = patterned(64, 9);
+    const ByteArray original = overlapping;
+    overlapping &= ByteView(overlapping).subview(10);
+    assert(overlapping == ByteArray(original & ByteView(original).subview(10)));
+    ByteArray shift_source = patterned(64, 9);
+    ByteArray::shift_left_into(ByteView(shift_source).first(40), 5, shift_source);
+    assert(shift_source == ByteArray(ByteArray(ByteView(original).first(40)) << 5));
+
+    // the excess prefix of the longer operand differs from the zero padding in every set bit
+    assert(hamming_distance(ByteArray({0xFF, 0x01}), ByteArray({0x00})) == 9);
+    assert(popcount(ByteView()) == 0);
+
+    // the chunked parallel paths give the same results
+    const parallel::Config saved = parallel::config();
+    parallel::set_config({.threshold = 4096, .chunk_size = 1000, .max_threads = 4});
+    const ByteArray big_a = patterned(100003, 5);
+    const ByteArray big_b = patterned(100003, 77);
+    uint64_t serial_popcount = 0;
+    for (size_t offset = 0; offset < big_a.size(); offset += 4000) {
+        serial_popcount += popcount(ByteView(big_a).subview(offset, 4000));
+    }
+    assert(popcount(big_a) == serial_popcount);
+    ByteArray big_out;
+    ByteArray::and_into(big_a, big_b, big_out);
+    assert(ByteView(big_out).subview(50000, 100) == ByteView(ByteArray(ByteArray(ByteView(big_a).subview(50000, 100)) & ByteView(big_b).subview(50000, 100))));
+    const ByteArray shifted_big = big_a << 13;
+    ByteArray shifted_in_place = big_a;
+    shifted_in_place <<= 13;
+    assert(shifted_big == shifted_in_place);
+    const ByteArray shifted_right_big = big_a >> 13;
+    ByteArray shifted_right_in_place = big_a;
+    shifted_right_in_place >>= 13;
+    assert(shifted_right_big == shifted_right_in_place);
+    assert(ByteView(shifted_big).first(8) == ByteView(ByteArray(ByteArray(ByteView(big_a).first(10)) << 13)).first(8));
+    parallel::set_config(saved);
+
+    PRINT_PASSED();
+}
+
+// Test the copy-on-write SharedByteArray
+void test_shared_byte_array() {
+    using jlizard::SharedByteArray;
+
+    const SharedByteArray empty;
+    assert(empty.empty() && empty.size() == 0 && empty.use_count() == 0);
+    assert(empty.view().empty() && empty.slice(0).empty());
+
+    // adopting moves the storage over, copies share it
+    ByteArray payload = patterned(1000, 3);
+    const unsigned char* payload_data = payload.data();
+    const SharedByteArray message(std::move(payload));
+    assert(message.data() == payload_data && message.size() == 1000);
+    assert(message == patterned(1000, 3));
+    SharedByteArray copy = message;
+    assert(copy.data() == message.data() && message.use_count() == 2);
+    SharedByteArray moved = std::move(copy);
+    assert(moved.data() == message.data() && message.use_count() == 2);
+    assert(copy.empty() && copy.use_count() == 0);
+    assert(moved[999] == patterned(1000, 3)[999]);
+    try {
+        (void)moved[1000];
+        assert(false);
+    } catch (const std::out_of_range&) {}
+    assert(SharedByteArray(ByteView(patterned(10, 1))) == patterned(10, 1));
+
+    // slices are views of the same block, also slices of slices
+    const SharedByteArray header = message.slice(0, 16);
+    const SharedByteArray body = message.slice(16);
+    const SharedByteArray inner = body.slice(100, 50);
+    assert(header.data() == message.data() && header.size() == 16);
+    assert(body.data() == message.data() + 16 && body.size() == 984);
+    assert(inner.data() == message.data() + 116 && inner == ByteView(message).subview(116, 50));
+    assert(message.slice(1000).empty() && message.slice(990, 100).size() == 10);
+    assert(message.use_count() == 5);
+    try {
+        (void)message.slice(1001);
+        assert(false);
+    } catch (const std::out_of_range&) {}
+
+    // the first write copies, every other handle keeps the old bytes
+    SharedByteArray edited = message;
+    edited.mutable_data()[0] = 0xEE;
+    assert(edited.data() != message.data() && edited.use_count() == 1);
+    assert(edited[0] == 0xEE && message[0] == patterned(1000, 3)[0]);
+    assert(ByteView(edited).subview(1) == ByteView(message).subview(1));
+    const unsigned char* edited_data = edited.data();
+    edited.mutable_data()[1] = 0xEF;
+    assert(edited.data() == edited_data);
+
+    // a unique slice writes in place, mutable_bytes() gives it an array of its own
+    SharedByteArray tail = edited.slice(990);
+    edited.reset();
+    assert(tail.use_count() == 1 && tail.mutable_data() == edited_data + 990);
+    ByteArray& tail_bytes = tail.mutable_bytes();
+    assert(tail_bytes.size() == 10 && tail.data() == tail_bytes.data());
+    tail_bytes.push_back(0x42);
+    assert(tail.size() == 11 && tail[10] == 0x42);
+
+    // XOR, comparison and chains take the shared bytes without copying them
+    const ByteArray key = patterned(16, 9);
+    assert((header ^ key) == (ByteArray(ByteView(message).first(16)) ^ key));
+    ByteChain chain;
+    chain.append(header).append(body);
+    assert(chain.segment(1).data() == body.data() && message.use_count() == 7);
+    assert(chain.flatten() == ByteView(message));
+
+    // release() moves out when it is the only owner and copies otherwise
+    SharedByteArray unique_owner(patterned(500, 5));
+    const unsigned char* unique_data = unique_owner.data();
+    const ByteArray released = unique_owner.release();
+    assert(released.data() == unique_data && unique_owner.empty());
+    SharedByteArray shared_owner = message;
+    const ByteArray released_copy = shared_owner.release();
+    assert(released_copy == ByteView(message) && released_copy.data() != message.data());
+    assert(message.to_byte_array() == ByteView(message));
+
+    // the last release wipes the block
+    ZeroCheckingResource resource;
+    {
+        ByteArray secret(&resource);
+        secret.concat(patterned(4096, 7));
+        SharedByteArray first(std::move(secret));
+        SharedByteArray second = first;
+        const SharedByteArray part = second.slice(10, 10);
+        first.reset();
+        second.reset();
+        assert(resource.deallocations == 0);
+    }
+    assert(resource.deallocations == 1 && resource.dirty_deallocations == 0);
+
+    // copies on other threads share the count safely
+    std::vector<std::thread> consumers;
+    for (int t = 0; t < 4; ++t) {
+        consumers.emplace_back([&message] {
+            for (int i = 0; i < 1000; ++i) {
+                const SharedByteArray local = message.slice(static_cast<size_t>(i % 100));
+                if (local.data() != message.data() + i % 100) std::abort();
+            }
+        });
+    }
+    for (auto& consumer : consumers) consumer.join();
+
+    PRINT_PASSED();
+}
+
 int main() {
     test_hex_string_constructor();
     test_vector_constructor();
     test_initializer_list_constructor();
     test_single_byte_constructor();
     test_xor_operators();
+    test_xor_assign_in_place();
+    test_inline_xor_paths();
+    test_xor_byte_with_empty_array();
     test_copy_move_semantics();
     test_iterators();
+    test_unchecked_access();
     test_secure_erase();
+    test_small_buffer_storage();
+    test_memory_resource_allocation();
+    test_secure_memory_resource();
     test_uint64_constructor_and_conversion();
     test_as_64bit_uint_exceptions();
+    test_integral_conversions();
+    test_fixed_byte_array();
     test_size_and_value_constructor();
     test_subscript_operator_bounds_checking();
     test_complement_operators();
+    test_bulk_xor_and_complement();
+    test_byte_view();
+    test_into_operations();
+    test_expression_templates();
     test_iterator_range_constructor();
     test_concat();
     test_concat_copy();
     test_concat_and_create();
     test_create_from_prng();
+    test_random_fill();
+    test_secure_equals();
+    test_wipe_policy();
+    test_byte_chain();
+    test_xor_stream();
+    test_mapped_byte_array();
+    test_parallel_ops();
+    test_byte_array_batch();
+    test_stats();
+    test_rvalue_operators();
+    test_append_and_insert();
+    test_byte_writer();
+    test_byte_reader();
+    test_bitwise_ops();
+    test_shared_byte_array();
     test_partial_copy_constructor();
+    test_partial_move_constructor();
+    test_copy_constructor_with_size_padding();
     test_resize_functionality();
     test_equality_operator();
     test_iterator_constructor_disambiguation();